@@ -0,0 +1,177 @@
+#pragma once
+
+#include <cstddef>
+#include <optional>
+#include <utility>
+
+namespace Nano
+{
+
+/// <summary>
+/// Returned by an accumulator to decide whether the emission continues.
+/// Accumulators returning anything else, bool included, never stop an emission.
+/// </summary>
+enum class Flow
+{
+    Continue,
+    Stop
+};
+
+//------------------------------------------------------------------------------
+
+/// <summary>
+/// Type-level accumulators for Nano::Signal::fire_accumulate&lt;Combiner&gt;
+/// Combiners returning Nano::Flow end the emission as soon as the result is known.
+/// </summary>
+namespace Combine
+{
+
+template <typename RT>
+class Sum final
+{
+    RT value = RT();
+
+    public:
+
+    inline void operator()(RT srv)
+    {
+        value += srv;
+    }
+
+    inline RT result() const
+    {
+        return value;
+    }
+};
+
+template <typename RT>
+class Min final
+{
+    std::optional<RT> value;
+
+    public:
+
+    inline void operator()(RT srv)
+    {
+        if (!value || srv < *value)
+        {
+            value = srv;
+        }
+    }
+
+    inline std::optional<RT> result() const
+    {
+        return value;
+    }
+};
+
+template <typename RT>
+class Max final
+{
+    std::optional<RT> value;
+
+    public:
+
+    inline void operator()(RT srv)
+    {
+        if (!value || *value < srv)
+        {
+            value = srv;
+        }
+    }
+
+    inline std::optional<RT> result() const
+    {
+        return value;
+    }
+};
+
+template <typename RT>
+class Last final
+{
+    std::optional<RT> value;
+
+    public:
+
+    inline void operator()(RT srv)
+    {
+        value = srv;
+    }
+
+    inline std::optional<RT> result() const
+    {
+        return value;
+    }
+};
+
+template <typename RT>
+class All final
+{
+    bool value = true;
+
+    public:
+
+    inline Flow operator()(RT srv)
+    {
+        // Continue only while every SRV has been true
+        return (value = static_cast<bool>(srv)) ? Flow::Continue : Flow::Stop;
+    }
+
+    inline bool result() const
+    {
+        return value;
+    }
+};
+
+template <typename RT>
+class Any final
+{
+    bool value = false;
+
+    public:
+
+    inline Flow operator()(RT srv)
+    {
+        // Continue only until the first true SRV
+        return (value = static_cast<bool>(srv)) ? Flow::Stop : Flow::Continue;
+    }
+
+    inline bool result() const
+    {
+        return value;
+    }
+};
+
+/// <summary>
+/// Copies SRVs into caller provided storage and stops the emission once it is full.
+/// Pass an instance to fire_accumulate since the storage can't be type-level.
+/// </summary>
+template <typename RT>
+class Collect_Into final
+{
+    RT* const first;
+    RT* const last;
+    RT* next;
+
+    public:
+
+    Collect_Into(RT* begin, RT* end) noexcept : first(begin), last(end), next(begin) {}
+
+    inline Flow operator()(RT srv)
+    {
+        if (next != last)
+        {
+            *next++ = std::move(srv);
+        }
+        return next != last ? Flow::Continue : Flow::Stop;
+    }
+
+    inline std::size_t result() const
+    {
+        return static_cast<std::size_t>(next - first);
+    }
+};
+
+} // namespace Combine
+
+} // namespace Nano ------------------------------------------------------------
@@ -0,0 +1,198 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+#include "nano_signal_slot.hpp"
+
+namespace Nano
+{
+
+/// <summary>
+/// Dense ids for event types, assigned once per type upon first use.
+/// Ids are shared by every dispatcher so a type indexes the same channel everywhere.
+/// </summary>
+class Event_Type final
+{
+    static inline std::size_t next() noexcept
+    {
+        static std::atomic_size_t count = { 0 };
+        return count.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    public:
+
+    // A function local static so that dispatchers used during static initialization see the id
+    template <typename E>
+    static inline std::size_t id() noexcept
+    {
+        static const std::size_t value = next();
+        return value;
+    }
+};
+
+//------------------------------------------------------------------------------
+
+/// <summary>
+/// Routes events to a Nano::Signal per event type held in a flat table indexed by Event_Type ids.
+/// Publishing is an indexed load followed by fire, no hashing and no type erasure on the way.
+/// Tables are only ever grown under lock and previous tables are kept alive for lock-free readers.
+/// </summary>
+/// <typeparam name="MT_Policy">The threading policy of the dispatcher and its signals</typeparam>
+template <typename MT_Policy = ST_Policy>
+class Dispatcher final : private MT_Policy
+{
+    struct Channel
+    {
+        virtual ~Channel() = default;
+    };
+
+    template <typename E>
+    struct Typed_Channel final : Channel
+    {
+        Signal<void(E const&), MT_Policy> signal;
+    };
+
+    struct Table
+    {
+        const std::size_t size;
+        const std::unique_ptr<std::atomic<Channel*>[]> channels;
+
+        explicit Table(std::size_t capacity) : size(capacity), channels(new std::atomic<Channel*>[capacity]) {}
+    };
+
+    template <typename Mem_Ptr>
+    struct Event {};
+    template <typename T, typename R, typename E>
+    struct Event<R(T::*)(E)> { using type = std::decay_t<E>; };
+    template <typename T, typename R, typename E>
+    struct Event<R(T::*)(E) const> { using type = std::decay_t<E>; };
+    template <typename T, typename R, typename E>
+    struct Event<R(T::*)(E) noexcept> { using type = std::decay_t<E>; };
+    template <typename T, typename R, typename E>
+    struct Event<R(T::*)(E) const noexcept> { using type = std::decay_t<E>; };
+
+    std::atomic<Table*> table = { nullptr };
+
+    std::vector<std::unique_ptr<Table>> tables;
+    std::vector<std::unique_ptr<Channel>> channels;
+
+    //--------------------------------------------------------------------------
+
+    template <typename E>
+    inline Typed_Channel<E>* find() const noexcept
+    {
+        auto id = Event_Type::id<E>();
+        auto current = table.load(std::memory_order_acquire);
+
+        if (current && id < current->size)
+        {
+            return static_cast<Typed_Channel<E>*>(current->channels[id].load(std::memory_order_acquire));
+        }
+        return nullptr;
+    }
+
+    template <typename E>
+    Typed_Channel<E>* find_or_create()
+    {
+        if (auto found = find<E>())
+        {
+            return found;
+        }
+
+        [[maybe_unused]]
+        auto lock = MT_Policy::lock_guard();
+
+        auto id = Event_Type::id<E>();
+        auto current = table.load(std::memory_order_relaxed);
+
+        // Grow geometrically, readers may still be using the previous table
+        if (!current || id >= current->size)
+        {
+            auto size = current ? current->size : 16;
+            while (size <= id)
+            {
+                size *= 2;
+            }
+            tables.reserve(tables.size() + 1);
+            tables.emplace_back(std::make_unique<Table>(size));
+            auto grown = tables.back().get();
+
+            for (std::size_t i = 0; i < size; ++i)
+            {
+                auto channel = current && i < current->size ?
+                    current->channels[i].load(std::memory_order_relaxed) : nullptr;
+                grown->channels[i].store(channel, std::memory_order_relaxed);
+            }
+            table.store(grown, std::memory_order_release);
+            current = grown;
+        }
+
+        if (auto channel = current->channels[id].load(std::memory_order_relaxed))
+        {
+            return static_cast<Typed_Channel<E>*>(channel);
+        }
+        channels.reserve(channels.size() + 1);
+        channels.emplace_back(std::make_unique<Typed_Channel<E>>());
+        auto created = static_cast<Typed_Channel<E>*>(channels.back().get());
+
+        current->channels[id].store(created, std::memory_order_release);
+
+        return created;
+    }
+
+    public:
+
+    Dispatcher() noexcept = default;
+    ~Dispatcher() noexcept = default;
+
+    Dispatcher(Dispatcher const&) = delete;
+    Dispatcher& operator= (Dispatcher const&) = delete;
+
+    Dispatcher(Dispatcher&&) = delete;
+    Dispatcher& operator= (Dispatcher&&) = delete;
+
+    /// <summary>
+    /// The signal of an event type, created upon first use, for use of the full Nano::Signal API
+    /// </summary>
+    template <typename E>
+    Signal<void(E const&), MT_Policy>& signal()
+    {
+        return find_or_create<E>()->signal;
+    }
+
+    //-------------------------------------------------------CONNECT / DISCONNECT
+
+    // The event type is that of the single parameter of the member function
+    template <auto mem_ptr, typename T>
+    void connect(T& instance)
+    {
+        signal<typename Event<decltype(mem_ptr)>::type>().template connect<mem_ptr>(instance);
+    }
+
+    template <auto mem_ptr, typename T>
+    void disconnect(T& instance)
+    {
+        if (auto channel = find<typename Event<decltype(mem_ptr)>::type>())
+        {
+            channel->signal.template disconnect<mem_ptr>(instance);
+        }
+    }
+
+    //-------------------------------------------------------------------PUBLISH
+
+    // Events of a type nobody ever connected to cost only the table lookup
+    template <typename E>
+    void publish(E const& event)
+    {
+        if (auto channel = find<E>())
+        {
+            channel->signal.fire(event);
+        }
+    }
+};
+
+} // namespace Nano ------------------------------------------------------------
@@ -1,12 +1,21 @@
 #pragma once
 
 #include <array>
+#include <cstddef>
 #include <cstdint>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 namespace Nano
 {
 
-using Delegate_Key = std::array<std::uintptr_t, 2>;
+// Instance pointer, thunk and the context word of slots bound with a context
+using Delegate_Key = std::array<std::uintptr_t, 3>;
 
 template <typename RT> class Function;
 template <typename RT, typename... Args>
@@ -15,14 +24,191 @@ class Function<RT(Args...)> final
     // Only Nano::Observer is allowed private access
     template <typename> friend class Observer;
 
-    using Thunk = RT(*)(void*, Args&&...);
+    /// <summary>
+    /// Carries a by-value argument to a slot without committing to copy or move.
+    /// Only arguments that arrived as rvalues are moved from.
+    /// </summary>
+    template <typename T>
+    class Argument final
+    {
+        T const* pointer;
+        const bool expiring;
+
+        public:
+
+        Argument(T const& lvalue) noexcept : pointer(std::addressof(lvalue)), expiring(false) {}
+        Argument(T&& rvalue) noexcept : pointer(std::addressof(rvalue)), expiring(true) {}
+        // Only the final slot of a forwarded emission may keep consuming the argument
+        Argument(Argument const& other, bool keep) noexcept : pointer(other.pointer), expiring(keep && other.expiring) {}
+
+        inline T const& peek() const noexcept
+        {
+            return *pointer;
+        }
+
+        inline T get() const
+        {
+            if (expiring)
+            {
+                return std::move(*const_cast<T*>(pointer));
+            }
+            return *pointer;
+        }
+    };
+
+    template <typename U>
+    struct Is_Argument : std::false_type {};
+    template <typename T>
+    struct Is_Argument<Argument<T>> : std::true_type {};
+
+    // References and trivially copyable values gain nothing from being moved
+    template <typename T>
+    using Param = std::conditional_t<std::is_reference_v<T>, T,
+        std::conditional_t<std::is_trivially_copyable_v<T>, T const&, Argument<T>>>;
+
+    using Thunk = RT(*)(void*, std::uintptr_t, Param<Args>...);
+
+    /// <summary>
+    /// The leading parameter of a member function slot which takes a context.
+    /// Contexts are stored inline within the Delegate_Key so they must fit in a single word.
+    /// </summary>
+    template <typename Mem_Ptr>
+    struct Context {};
+    template <typename T, typename R, typename C, typename... A>
+    struct Context<R(T::*)(C, A...)> { using type = std::decay_t<C>; };
+    template <typename T, typename R, typename C, typename... A>
+    struct Context<R(T::*)(C, A...) const> { using type = std::decay_t<C>; };
+    template <typename T, typename R, typename C, typename... A>
+    struct Context<R(T::*)(C, A...) noexcept> { using type = std::decay_t<C>; };
+    template <typename T, typename R, typename C, typename... A>
+    struct Context<R(T::*)(C, A...) const noexcept> { using type = std::decay_t<C>; };
+
+    /// <summary>
+    /// Number of parameters of a function or member function slot.
+    /// Slots may take only a prefix of the signal's arguments, the rest are never touched.
+    /// </summary>
+    template <typename Fun_Ptr>
+    struct Arity {};
+    template <typename R, typename... A>
+    struct Arity<R(*)(A...)> : std::integral_constant<std::size_t, sizeof...(A)> {};
+    template <typename R, typename... A>
+    struct Arity<R(*)(A...) noexcept> : std::integral_constant<std::size_t, sizeof...(A)> {};
+    template <typename T, typename R, typename... A>
+    struct Arity<R(T::*)(A...)> : std::integral_constant<std::size_t, sizeof...(A)> {};
+    template <typename T, typename R, typename... A>
+    struct Arity<R(T::*)(A...) const> : std::integral_constant<std::size_t, sizeof...(A)> {};
+    template <typename T, typename R, typename... A>
+    struct Arity<R(T::*)(A...) noexcept> : std::integral_constant<std::size_t, sizeof...(A)> {};
+    template <typename T, typename R, typename... A>
+    struct Arity<R(T::*)(A...) const noexcept> : std::integral_constant<std::size_t, sizeof...(A)> {};
+
+    template <typename Slot>
+    static constexpr std::size_t arity = Arity<Slot>::value;
+
+    template <typename C>
+    static inline std::uintptr_t pack(C const& context) noexcept
+    {
+        static_assert(std::is_trivially_copyable_v<C> && sizeof(C) <= sizeof(std::uintptr_t),
+            "A slot context must be trivially copyable and no larger than a pointer");
+
+        std::uintptr_t word = 0;
+        std::memcpy(&word, std::addressof(context), sizeof(C));
+        return word;
+    }
+
+    template <typename C>
+    static inline C unpack_context(std::uintptr_t word) noexcept
+    {
+        C context;
+        std::memcpy(std::addressof(context), &word, sizeof(C));
+        return context;
+    }
+
+    template <typename T, typename U>
+    static inline decltype(auto) adapt(U&& arg)
+    {
+        // Reference parameters always bind to the argument as an lvalue
+        if constexpr (std::is_reference_v<T>)
+        {
+            return (arg);
+        }
+        else if constexpr (std::is_same_v<std::decay_t<U>, T>)
+        {
+            return std::forward<U>(arg);
+        }
+        // Arguments forwarded from another signal are passed on without being copied
+        else if constexpr (std::is_same_v<std::decay_t<U>, Argument<T>>)
+        {
+            return Argument<T>(arg, std::is_rvalue_reference_v<U&&>);
+        }
+        // Convert up front so that the Argument refers to a temporary of type T
+        else
+        {
+            static_assert(std::is_convertible_v<U&&, T>, "An argument must implicitly convert to its parameter");
+
+            T converted = std::forward<U>(arg);
+            return converted;
+        }
+    }
+
+    template <typename T>
+    static inline decltype(auto) unpack(Param<T> arg)
+    {
+        if constexpr (std::is_reference_v<T>)
+        {
+            return static_cast<T&&>(arg);
+        }
+        else if constexpr (std::is_trivially_copyable_v<T>)
+        {
+            return arg;
+        }
+        else
+        {
+            return arg.get();
+        }
+    }
+
+    template <std::size_t I>
+    using Nth = std::tuple_element_t<I, std::tuple<Args...>>;
+
+    using Params = std::tuple<Param<Args>&...>;
+
+    //--------------------------------------------------------------------------
+    // Slots are called with the first sizeof...(I) arguments only, converting as needed.
+    // Casting to RT discards the return value of slots connected to a void signal.
+
+    template <auto fun_ptr, std::size_t... I>
+    static inline RT call(Params& params, std::index_sequence<I...>)
+    {
+        return static_cast<RT>((*fun_ptr)(unpack<Nth<I>>(std::get<I>(params))...));
+    }
+
+    template <auto mem_ptr, typename T, std::size_t... I>
+    static inline RT call(T* instance, Params& params, std::index_sequence<I...>)
+    {
+        return static_cast<RT>((instance->*mem_ptr)(unpack<Nth<I>>(std::get<I>(params))...));
+    }
+
+    template <auto mem_ptr, typename T, typename C, std::size_t... I>
+    static inline RT call(T* instance, C&& context, Params& params, std::index_sequence<I...>)
+    {
+        return static_cast<RT>((instance->*mem_ptr)(std::forward<C>(context), unpack<Nth<I>>(std::get<I>(params))...));
+    }
+
+    template <typename Slot, std::size_t skip = 0>
+    static constexpr auto prefix()
+    {
+        static_assert(arity<Slot> - skip <= sizeof...(Args), "A slot cannot take more arguments than its signal");
+        return std::make_index_sequence<arity<Slot> - skip>();
+    }
 
     static inline Function bind(Delegate_Key const& delegate_key)
     {
         return
         {
             reinterpret_cast<void*>(delegate_key[0]),
-            reinterpret_cast<Thunk>(delegate_key[1])
+            reinterpret_cast<Thunk>(delegate_key[1]),
+            delegate_key[2]
         };
     }
 
@@ -30,16 +216,19 @@ class Function<RT(Args...)> final
 
     void* const instance_pointer;
     const Thunk function_pointer;
+    const std::uintptr_t context_word;
 
     template <auto fun_ptr>
     static inline Function bind()
     {
         return
         {
-            nullptr, [](void* /*NULL*/, Args&&... args)
+            nullptr, [](void* /*NULL*/, std::uintptr_t, Param<Args>... args) -> RT
             {
-                return (*fun_ptr)(std::forward<Args>(args)...);
-            }
+                Params params(args...);
+                return call<fun_ptr>(params, prefix<decltype(fun_ptr)>());
+            },
+            0
         };
     }
 
@@ -48,10 +237,30 @@ class Function<RT(Args...)> final
     {
         return
         {
-            pointer, [](void* this_ptr, Args&&... args)
+            pointer, [](void* this_ptr, std::uintptr_t, Param<Args>... args) -> RT
             {
-                return (static_cast<T*>(this_ptr)->*mem_ptr)(std::forward<Args>(args)...);
-            }
+                Params params(args...);
+                return call<mem_ptr>(static_cast<T*>(this_ptr), params, prefix<decltype(mem_ptr)>());
+            },
+            0
+        };
+    }
+
+    // The context is passed as the leading argument of the member function
+    template <auto mem_ptr, typename T>
+    static inline Function bind(T* pointer, typename Context<decltype(mem_ptr)>::type const& context)
+    {
+        using C = typename Context<decltype(mem_ptr)>::type;
+
+        return
+        {
+            pointer, [](void* this_ptr, std::uintptr_t word, Param<Args>... args) -> RT
+            {
+                Params params(args...);
+                return call<mem_ptr>(static_cast<T*>(this_ptr), unpack_context<C>(word), params,
+                    prefix<decltype(mem_ptr), 1>());
+            },
+            pack(context)
         };
     }
 
@@ -60,17 +269,48 @@ class Function<RT(Args...)> final
     {
         return
         {
-            pointer, [](void* this_ptr, Args&&... args)
+            pointer, [](void* this_ptr, std::uintptr_t, Param<Args>... args) -> RT
             {
-                return static_cast<L*>(this_ptr)->operator()(std::forward<Args>(args)...);
-            }
+                return static_cast<RT>(static_cast<L*>(this_ptr)->operator()(unpack<Args>(args)...));
+            },
+            0
+        };
+    }
+
+    // The value of an argument as passed along a forwarded emission, without consuming it
+    template <typename U>
+    static inline decltype(auto) peek(U& arg) noexcept
+    {
+        if constexpr (Is_Argument<std::remove_const_t<U>>::value)
+        {
+            return arg.peek();
+        }
+        else
+        {
+            return (arg);
+        }
+    }
+
+    // Hands the arguments as they are to the signal targeted by the relay
+    template <typename T>
+    static inline Function bind_forward(T* relay)
+    {
+        return
+        {
+            relay, [](void* this_ptr, std::uintptr_t, Param<Args>... args) -> RT
+            {
+                static_cast<T*>(this_ptr)->target->forwarded(std::move(args)...);
+            },
+            0
         };
     }
 
+    // By-value arguments passed as rvalues are moved into the slot, lvalues are copied
     template <typename... Uref>
     inline RT operator() (Uref&&... args) const
     {
-        return (*function_pointer)(instance_pointer, static_cast<Args&&>(args)...);
+        return (*function_pointer)(instance_pointer, context_word,
+            static_cast<Param<Args>>(adapt<Args>(std::forward<Uref>(args)))...);
     }
 
     inline operator Delegate_Key() const
@@ -78,9 +318,255 @@ class Function<RT(Args...)> final
         return
         {
             reinterpret_cast<std::uintptr_t>(instance_pointer),
-            reinterpret_cast<std::uintptr_t>(function_pointer)
+            reinterpret_cast<std::uintptr_t>(function_pointer),
+            context_word
         };
     }
 };
 
+//------------------------------------------------------------------------------
+
+/// <summary>
+/// Owns the function objects that were moved into a signal.
+/// Function objects of up to 32 bytes share pooled blocks, larger ones are allocated alone.
+/// Their addresses never change so they can serve as the instance half of a Delegate_Key,
+/// while the handle of their entry serves as the context word which functor thunks ignore.
+/// </summary>
+class Function_Pool final
+{
+    union Block
+    {
+        Block* next;
+        alignas(std::max_align_t) unsigned char storage[32];
+    };
+
+    // Entries are addressed by handle, their index plus one, so that zero can end a list
+    struct Entry
+    {
+        void* object;
+        void (*release)(Function_Pool&, void*);
+        std::uintptr_t next;
+        bool retired;
+    };
+
+    static constexpr std::size_t chunk_size = 32;
+
+    template <typename T>
+    static constexpr bool pooled = sizeof(T) <= sizeof(Block) && alignof(T) <= alignof(Block);
+
+    std::vector<std::unique_ptr<Block[]>> chunks;
+    Block* free_list = nullptr;
+
+    std::vector<Entry> entries;
+    // Intrusive lists threaded through the entries so that retiring never allocates
+    std::uintptr_t free_entries = 0;
+    std::uintptr_t retired_entries = 0;
+    std::size_t live = 0;
+    // Bytes of the function objects too large to be pooled
+    std::size_t unpooled_bytes = 0;
+
+    inline void* allocate()
+    {
+        if (!free_list)
+        {
+            chunks.emplace_back(new Block[chunk_size]);
+
+            for (auto block = chunks.back().get(), end = block + chunk_size; block != end; ++block)
+            {
+                block->next = std::exchange(free_list, block);
+            }
+        }
+        return std::exchange(free_list, free_list->next);
+    }
+
+    inline void deallocate(void* memory) noexcept
+    {
+        auto block = static_cast<Block*>(memory);
+        block->next = std::exchange(free_list, block);
+    }
+
+    template <typename T>
+    static inline void release(Function_Pool& pool, void* object) noexcept
+    {
+        if constexpr (pooled<T>)
+        {
+            static_cast<T*>(object)->~T();
+            pool.deallocate(object);
+        }
+        else
+        {
+            delete static_cast<T*>(object);
+            pool.unpooled_bytes -= sizeof(T);
+        }
+    }
+
+    inline void release(std::uintptr_t handle) noexcept
+    {
+        auto& entry = entries[handle - 1];
+
+        entry.release(*this, std::exchange(entry.object, nullptr));
+        entry.next = std::exchange(free_entries, handle);
+        entry.retired = false;
+        --live;
+    }
+
+    inline std::uintptr_t acquire()
+    {
+        if (free_entries)
+        {
+            return std::exchange(free_entries, entries[free_entries - 1].next);
+        }
+        entries.push_back({ nullptr, nullptr, 0, false });
+        return entries.size();
+    }
+
+    public:
+
+    Function_Pool() noexcept = default;
+    ~Function_Pool()
+    {
+        release_all();
+    }
+
+    Function_Pool(Function_Pool const&) = delete;
+    Function_Pool& operator= (Function_Pool const&) = delete;
+
+    Function_Pool(Function_Pool&& other) noexcept :
+        chunks(std::move(other.chunks)),
+        free_list(std::exchange(other.free_list, nullptr)),
+        entries(std::move(other.entries)),
+        free_entries(std::exchange(other.free_entries, 0)),
+        retired_entries(std::exchange(other.retired_entries, 0)),
+        live(std::exchange(other.live, 0)),
+        unpooled_bytes(std::exchange(other.unpooled_bytes, 0))
+    {
+
+    }
+
+    Function_Pool& operator= (Function_Pool&& other) noexcept
+    {
+        release_all();
+
+        chunks = std::move(other.chunks);
+        free_list = std::exchange(other.free_list, nullptr);
+        entries = std::move(other.entries);
+        free_entries = std::exchange(other.free_entries, 0);
+        retired_entries = std::exchange(other.retired_entries, 0);
+        live = std::exchange(other.live, 0);
+        unpooled_bytes = std::exchange(other.unpooled_bytes, 0);
+
+        return *this;
+    }
+
+    /// <summary>
+    /// Returns the constructed object along with the handle that retires it
+    /// </summary>
+    template <typename L>
+    inline std::pair<std::decay_t<L>*, std::uintptr_t> construct(L&& functor)
+    {
+        using T = std::decay_t<L>;
+
+        // Acquire the entry first so that nothing can throw once the object exists
+        auto handle = acquire();
+
+        T* object = nullptr;
+        try
+        {
+            if constexpr (pooled<T>)
+            {
+                auto memory = allocate();
+                try
+                {
+                    object = ::new (memory) T(std::forward<L>(functor));
+                }
+                catch (...)
+                {
+                    deallocate(memory);
+                    throw;
+                }
+            }
+            else
+            {
+                object = new T(std::forward<L>(functor));
+                unpooled_bytes += sizeof(T);
+            }
+        }
+        catch (...)
+        {
+            entries[handle - 1].next = std::exchange(free_entries, handle);
+            throw;
+        }
+        entries[handle - 1] = { object, &release<T>, 0, false };
+        ++live;
+
+        return { object, handle };
+    }
+
+    /// <summary>
+    /// Stops owning the object of the key until the next collect, returns false if it was never owned
+    /// </summary>
+    inline bool retire(Delegate_Key const& key) noexcept
+    {
+        auto handle = key[2];
+
+        // Keys of other slots either carry no handle or one not matching their instance
+        if (handle == 0 || handle > entries.size())
+        {
+            return false;
+        }
+        auto& entry = entries[handle - 1];
+
+        if (!entry.object || entry.retired || entry.object != reinterpret_cast<void*>(key[0]))
+        {
+            return false;
+        }
+        entry.retired = true;
+        entry.next = std::exchange(retired_entries, handle);
+
+        return true;
+    }
+
+    inline void retire_all() noexcept
+    {
+        for (std::size_t i = 0; i < entries.size(); ++i)
+        {
+            if (entries[i].object && !entries[i].retired)
+            {
+                entries[i].retired = true;
+                entries[i].next = std::exchange(retired_entries, i + 1);
+            }
+        }
+    }
+
+    /// <summary>
+    /// Destroys every retired object, only call once nothing can still invoke them
+    /// </summary>
+    inline void collect() noexcept
+    {
+        while (retired_entries)
+        {
+            auto handle = retired_entries;
+            retired_entries = entries[handle - 1].next;
+            release(handle);
+        }
+    }
+
+    inline void release_all() noexcept
+    {
+        retire_all();
+        collect();
+    }
+
+    inline bool empty() const noexcept
+    {
+        return live == 0;
+    }
+
+    inline std::size_t footprint_bytes() const noexcept
+    {
+        return chunks.capacity() * sizeof(chunks.front()) + chunks.size() * chunk_size * sizeof(Block)
+            + entries.capacity() * sizeof(Entry) + unpooled_bytes;
+    }
+};
+
 } // namespace Nano ------------------------------------------------------------
@@ -0,0 +1,193 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include "nano_function.hpp"
+
+namespace Nano
+{
+
+/// <summary>
+/// Open addressing (linear probing) index from Delegate_Key to a position in a connection list.
+/// Buckets hold a 32 bit hash so that most mismatches are rejected without touching the list.
+/// Erasure shifts the following run backwards so lookups never wade through deleted buckets.
+/// </summary>
+class Flat_Index final
+{
+    struct Bucket
+    {
+        std::uint32_t hash = 0;
+        // Position + 1 so that a zeroed bucket is empty
+        std::uint32_t position = 0;
+    };
+
+    std::vector<Bucket> buckets;
+    std::size_t count = 0;
+
+    static inline std::uint32_t hash_of(Delegate_Key const& key) noexcept
+    {
+        std::uint64_t thunk = key[1];
+        std::uint64_t hash = (key[0] + key[2] * 0xC2B2AE3D27D4EB4Full) ^ ((thunk << 32) | (thunk >> 32));
+        hash *= 0x9E3779B97F4A7C15ull;
+        return static_cast<std::uint32_t>(hash >> 32);
+    }
+
+    inline std::size_t mask() const noexcept
+    {
+        return buckets.size() - 1;
+    }
+
+    inline void place(Bucket const& bucket) noexcept
+    {
+        auto i = bucket.hash & mask();
+        while (buckets[i].position)
+        {
+            i = (i + 1) & mask();
+        }
+        buckets[i] = bucket;
+    }
+
+    public:
+
+    static constexpr std::size_t npos = std::numeric_limits<std::size_t>::max();
+
+    /// <summary>
+    /// Keeps the load factor at or below one half for the given number of positions
+    /// </summary>
+    inline void reserve(std::size_t size)
+    {
+        std::size_t target = 16;
+        while (target < size * 2)
+        {
+            target *= 2;
+        }
+        if (target <= buckets.size())
+        {
+            return;
+        }
+        std::vector<Bucket> previous(target);
+        previous.swap(buckets);
+
+        for (auto const& bucket : previous)
+        {
+            if (bucket.position)
+            {
+                place(bucket);
+            }
+        }
+    }
+
+    // Empties the index while keeping its buckets
+    inline void clear() noexcept
+    {
+        std::fill(std::begin(buckets), std::end(buckets), Bucket());
+        count = 0;
+    }
+
+    /// <summary>
+    /// Indexes the position, reserve beforehand for this to be noexcept
+    /// </summary>
+    inline void insert(Delegate_Key const& key, std::size_t position)
+    {
+        reserve(count + 1);
+
+        place({ hash_of(key), static_cast<std::uint32_t>(position + 1) });
+        ++count;
+    }
+
+    /// <summary>
+    /// Returns the first indexed position with this key for which match(position) holds
+    /// </summary>
+    template <typename Match>
+    inline std::size_t find(Delegate_Key const& key, Match&& match) const
+    {
+        if (!count)
+        {
+            return npos;
+        }
+        auto hash = hash_of(key);
+
+        for (auto i = hash & mask(); buckets[i].position; i = (i + 1) & mask())
+        {
+            if (buckets[i].hash == hash && match(buckets[i].position - 1))
+            {
+                return buckets[i].position - 1;
+            }
+        }
+        return npos;
+    }
+
+    inline void erase(Delegate_Key const& key, std::size_t position) noexcept
+    {
+        if (!count)
+        {
+            return;
+        }
+        auto i = hash_of(key) & mask();
+
+        for (; buckets[i].position; i = (i + 1) & mask())
+        {
+            if (buckets[i].position == position + 1)
+            {
+                break;
+            }
+        }
+        if (!buckets[i].position)
+        {
+            return;
+        }
+        // Shift back every bucket that would otherwise become unreachable
+        for (auto j = (i + 1) & mask(); buckets[j].position; j = (j + 1) & mask())
+        {
+            auto home = buckets[j].hash & mask();
+
+            if (((j - home) & mask()) >= ((j - i) & mask()))
+            {
+                buckets[i] = buckets[j];
+                i = j;
+            }
+        }
+        buckets[i] = Bucket();
+        --count;
+    }
+
+    inline std::size_t size() const noexcept
+    {
+        return count;
+    }
+
+    inline std::size_t footprint_bytes() const noexcept
+    {
+        return buckets.capacity() * sizeof(Bucket);
+    }
+};
+
+//------------------------------------------------------------------------------
+
+/// <summary>
+/// Indexed Policy
+/// Wraps any threading policy to keep a Flat_Index of its connections.
+/// Connect and disconnect become O(1) and emission follows connection order instead of thunk order.
+/// Only worthwhile for very wide signals, small signals are faster with the sorted list alone.
+/// </summary>
+/// <typeparam name="MT_Policy">The threading policy being indexed</typeparam>
+template <typename MT_Policy>
+class Indexed : public MT_Policy
+{
+    public:
+
+    static constexpr bool indexed = true;
+
+    protected:
+
+    Indexed() noexcept = default;
+    ~Indexed() noexcept = default;
+
+    Flat_Index flat_index;
+};
+
+} // namespace Nano ------------------------------------------------------------
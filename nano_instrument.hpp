@@ -0,0 +1,771 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <type_traits>
+#include <typeinfo>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#if defined(__has_include)
+#if __has_include(<dlfcn.h>)
+#include <dlfcn.h>
+#define NANO_HAS_DLADDR
+#endif
+#if __has_include(<cxxabi.h>)
+#include <cxxabi.h>
+#define NANO_HAS_DEMANGLE
+#endif
+#endif
+
+#include "nano_function.hpp"
+#include "nano_mutex.hpp"
+
+namespace Nano
+{
+
+/// <summary>
+/// Snapshot of the counters kept by Nano::Instrumented
+/// </summary>
+struct Statistics
+{
+    std::uint64_t fire_count = 0;
+    std::uint64_t slot_count = 0;
+    std::uint64_t max_fan_out = 0;
+    std::uint64_t connections = 0;
+    std::uint64_t capacity = 0;
+    std::uint64_t bytes = 0;
+    std::chrono::nanoseconds fire_time {};
+    std::chrono::nanoseconds slot_time {};
+    std::chrono::nanoseconds lock_wait {};
+};
+
+//------------------------------------------------------------------------------
+
+/// <summary>
+/// Log-linear latency histogram in the style of HdrHistogram.
+/// Values are kept to five significant bits which bounds the error of any percentile to about 3%.
+/// </summary>
+class Histogram
+{
+    static constexpr std::size_t sub_bits = 5;
+    static constexpr std::size_t sub_buckets = 1 << sub_bits;
+
+    std::array<std::uint64_t, (64 - sub_bits + 1) * sub_buckets> counts {};
+    std::uint64_t total = 0;
+    std::uint64_t largest = 0;
+
+    static inline std::size_t msb(std::uint64_t value) noexcept
+    {
+        std::size_t bit = 0;
+        for (std::size_t shift = 32; shift; shift >>= 1)
+        {
+            if (value >> (bit + shift))
+            {
+                bit += shift;
+            }
+        }
+        return bit;
+    }
+
+    static inline std::size_t bucket_of(std::uint64_t value) noexcept
+    {
+        if (value < sub_buckets)
+        {
+            return static_cast<std::size_t>(value);
+        }
+        auto bit = msb(value);
+        auto mantissa = static_cast<std::size_t>(value >> (bit - sub_bits)) & (sub_buckets - 1);
+        return (bit - sub_bits + 1) * sub_buckets + mantissa;
+    }
+
+    static inline std::uint64_t highest_of(std::size_t bucket) noexcept
+    {
+        if (bucket < sub_buckets)
+        {
+            return bucket;
+        }
+        auto shift = bucket / sub_buckets - 1;
+        auto lowest = (sub_buckets + bucket % sub_buckets) << shift;
+        return lowest + ((std::uint64_t(1) << shift) - 1);
+    }
+
+    public:
+
+    inline void record(std::chrono::nanoseconds elapsed) noexcept
+    {
+        auto value = static_cast<std::uint64_t>(std::max<std::int64_t>(elapsed.count(), 0));
+
+        ++counts[bucket_of(value)];
+        ++total;
+        largest = std::max(largest, value);
+    }
+
+    inline std::uint64_t count() const noexcept
+    {
+        return total;
+    }
+
+    inline std::chrono::nanoseconds max() const noexcept
+    {
+        return std::chrono::nanoseconds(largest);
+    }
+
+    /// <summary>
+    /// Returns the upper bound of the bucket holding the given percentile [0, 100]
+    /// </summary>
+    inline std::chrono::nanoseconds percentile(double percent) const noexcept
+    {
+        auto rank = static_cast<std::uint64_t>(percent / 100.0 * static_cast<double>(total) + 0.5);
+        std::uint64_t seen = 0;
+
+        for (std::size_t bucket = 0; bucket < counts.size(); ++bucket)
+        {
+            if ((seen += counts[bucket]) >= std::max<std::uint64_t>(rank, 1))
+            {
+                auto highest = std::min(highest_of(bucket), largest);
+                return std::chrono::nanoseconds(highest);
+            }
+        }
+        return max();
+    }
+};
+
+//------------------------------------------------------------------------------
+
+/// <summary>
+/// Demangles an Itanium ABI symbol, returning it unchanged when that is not possible
+/// </summary>
+inline std::string demangle(const char* symbol)
+{
+#if defined(NANO_HAS_DEMANGLE)
+    int status = 0;
+    std::unique_ptr<char, decltype(&std::free)> demangled(
+        abi::__cxa_demangle(symbol, nullptr, nullptr, &status), &std::free);
+
+    if (status == 0)
+    {
+        return demangled.get();
+    }
+#endif
+    return symbol;
+}
+
+/// <summary>
+/// Formats an address as fixed width hexadecimal
+/// </summary>
+inline std::string hex_address(std::uintptr_t address)
+{
+    std::string hex(2 + sizeof(address) * 2, '0');
+    hex[1] = 'x';
+    for (auto digit = hex.rbegin(); address; address >>= 4)
+    {
+        *digit++ = "0123456789abcdef"[address & 0xF];
+    }
+    return hex;
+}
+
+/// <summary>
+/// Resolves a thunk address to the symbol of the bound slot.
+/// Thunk symbols name their bound mem_ptr / fun_ptr as a template argument.
+/// On Linux the executable must export its symbols (-rdynamic) for dladdr to see them.
+/// </summary>
+inline std::string symbol_name(std::uintptr_t address)
+{
+#if defined(NANO_HAS_DLADDR)
+    Dl_info info;
+
+    if (dladdr(reinterpret_cast<void*>(address), &info) && info.dli_sname)
+    {
+        return demangle(info.dli_sname);
+    }
+#endif
+    return hex_address(address);
+}
+
+//------------------------------------------------------------------------------
+
+/// <summary>
+/// Process wide emission tracer exporting the Chrome Trace Event format.
+/// Each thread appends begin/end events to its own buffer which is only contended while writing.
+/// Open the output in chrome://tracing or ui.perfetto.dev.
+/// </summary>
+class Trace final
+{
+    using Clock = std::chrono::steady_clock;
+
+    struct Event
+    {
+        Clock::time_point timestamp;
+        std::uintptr_t thunk;
+        const char* name;
+        char phase;
+    };
+
+    struct Buffer
+    {
+        Spin_Mutex mutex;
+        std::vector<Event> events;
+        std::size_t thread = 0;
+    };
+
+    struct Registry
+    {
+        std::mutex mutex;
+        std::vector<std::unique_ptr<Buffer>> buffers;
+        std::atomic_bool enabled = { false };
+    };
+
+    static inline Registry& registry()
+    {
+        // Never destroyed so that signals with static storage may still trace on exit
+        static Registry* instance = new Registry;
+        return *instance;
+    }
+
+    static inline Buffer& local()
+    {
+        // Buffers are owned by the registry so that events outlive their thread
+        thread_local Buffer* buffer = []
+        {
+            auto& shared = registry();
+
+            std::lock_guard<std::mutex> lock(shared.mutex);
+            shared.buffers.push_back(std::make_unique<Buffer>());
+            shared.buffers.back()->thread = shared.buffers.size();
+
+            return shared.buffers.back().get();
+        }();
+        return *buffer;
+    }
+
+    static inline void write_escaped(std::ostream& os, std::string const& text)
+    {
+        for (auto character : text)
+        {
+            if (character == '"' || character == '\\')
+            {
+                os << '\\';
+            }
+            os << character;
+        }
+    }
+
+    public:
+
+    static inline void enable(bool enabled) noexcept
+    {
+        registry().enabled.store(enabled, std::memory_order_relaxed);
+    }
+
+    static inline bool enabled() noexcept
+    {
+        return registry().enabled.load(std::memory_order_relaxed);
+    }
+
+    /// <summary>
+    /// Records a begin ('B') or end ('E') event for the calling thread.
+    /// Events without a name are named after the symbol of their thunk when written.
+    /// </summary>
+    static inline void record(char phase, const char* name, std::uintptr_t thunk = 0)
+    {
+        auto& buffer = local();
+
+        std::lock_guard<Spin_Mutex> lock(buffer.mutex);
+        buffer.events.push_back({ Clock::now(), thunk, name, phase });
+    }
+
+    /// <summary>
+    /// Drains every thread's events into a Chrome Trace Event JSON document
+    /// </summary>
+    static inline void write(std::ostream& os)
+    {
+        auto& shared = registry();
+
+        std::lock_guard<std::mutex> lock(shared.mutex);
+        std::unordered_map<std::uintptr_t, std::string> symbols;
+
+        os << "{\"traceEvents\":[";
+
+        const char* separator = "\n";
+        for (auto const& buffer : shared.buffers)
+        {
+            std::vector<Event> events;
+            {
+                std::lock_guard<Spin_Mutex> drain(buffer->mutex);
+                events.swap(buffer->events);
+            }
+            for (auto const& event : events)
+            {
+                auto timestamp = std::chrono::duration<double, std::micro>(event.timestamp.time_since_epoch());
+
+                os << separator << "{\"name\":\"";
+                if (event.name)
+                {
+                    write_escaped(os, event.name);
+                }
+                else
+                {
+                    auto symbol = symbols.find(event.thunk);
+                    if (symbol == symbols.end())
+                    {
+                        symbol = symbols.emplace(event.thunk, symbol_name(event.thunk)).first;
+                    }
+                    write_escaped(os, symbol->second);
+                }
+                os << "\",\"ph\":\"" << event.phase << "\",\"ts\":" << std::fixed
+                   << std::setprecision(3) << timestamp.count() << ",\"pid\":1,\"tid\":" << buffer->thread << "}";
+
+                separator = ",\n";
+            }
+        }
+        os << "\n]}\n";
+    }
+};
+
+//------------------------------------------------------------------------------
+
+/// <summary>
+/// Process wide registry of every live Nano::Instrumented signal and observer.
+/// Report the memory held by the connection graph to find oversized or bloated signals.
+/// </summary>
+class Footprint final
+{
+    public:
+
+    struct Entry
+    {
+        const void* address = nullptr;
+        const char* name = nullptr;
+        const char* policy = nullptr;
+        std::uint64_t connections = 0;
+        std::uint64_t capacity = 0;
+        std::uint64_t bytes = 0;
+        std::uint64_t max_fan_out = 0;
+    };
+
+    /// <summary>
+    /// Intrusive registration held by each instrumented instance for its lifetime
+    /// </summary>
+    class Link final
+    {
+        friend class Footprint;
+
+        Link* prev = nullptr;
+        Link* next = nullptr;
+
+        const void* const owner;
+        Entry (* const sample)(const void*);
+
+        public:
+
+        Link(const void* instance, Entry (*sampler)(const void*)) noexcept : owner(instance), sample(sampler)
+        {
+            auto& shared = registry();
+
+            std::lock_guard<Spin_Mutex> lock(shared.mutex);
+            if ((next = shared.head))
+            {
+                next->prev = this;
+            }
+            shared.head = this;
+            ++shared.count;
+        }
+
+        ~Link()
+        {
+            auto& shared = registry();
+
+            std::lock_guard<Spin_Mutex> lock(shared.mutex);
+            (prev ? prev->next : shared.head) = next;
+            if (next)
+            {
+                next->prev = prev;
+            }
+            --shared.count;
+        }
+
+        Link(Link const&) = delete;
+        Link& operator= (Link const&) = delete;
+    };
+
+    private:
+
+    struct Registry
+    {
+        Spin_Mutex mutex;
+        Link* head = nullptr;
+        std::size_t count = 0;
+    };
+
+    static inline Registry& registry()
+    {
+        // Never destroyed so that instances with static storage may still unlink on exit
+        static Registry* instance = new Registry;
+        return *instance;
+    }
+
+    public:
+
+    /// <summary>
+    /// Samples every live instance, largest footprint first
+    /// </summary>
+    static inline std::vector<Entry> snapshot()
+    {
+        auto& shared = registry();
+
+        std::vector<Entry> entries;
+        {
+            std::lock_guard<Spin_Mutex> lock(shared.mutex);
+
+            entries.reserve(shared.count);
+            for (auto link = shared.head; link; link = link->next)
+            {
+                entries.push_back(link->sample(link->owner));
+            }
+        }
+        std::sort(std::begin(entries), std::end(entries), [](Entry const& lhs, Entry const& rhs)
+        {
+            return rhs.bytes < lhs.bytes;
+        });
+        return entries;
+    }
+
+    /// <summary>
+    /// Writes a totals line followed by the largest instances, limit of zero writes all
+    /// </summary>
+    static inline void report(std::ostream& os, std::size_t limit = 0)
+    {
+        auto entries = snapshot();
+
+        std::uint64_t connections = 0;
+        std::uint64_t capacity = 0;
+        std::uint64_t bytes = 0;
+
+        for (auto const& entry : entries)
+        {
+            connections += entry.connections;
+            capacity += entry.capacity;
+            bytes += entry.bytes;
+        }
+
+        os << entries.size() << " instances, " << connections << " connections, "
+           << capacity << " capacity, " << bytes << " bytes\n";
+
+        os << std::setw(12) << "bytes" << std::setw(12) << "size" << std::setw(12)
+           << "capacity" << std::setw(12) << "max fan" << "  name [policy]\n";
+
+        std::unordered_map<const char*, std::string> policies;
+
+        if (limit && limit < entries.size())
+        {
+            entries.resize(limit);
+        }
+        for (auto const& entry : entries)
+        {
+            auto policy = policies.find(entry.policy);
+            if (policy == policies.end())
+            {
+                policy = policies.emplace(entry.policy, demangle(entry.policy)).first;
+            }
+            os << std::setw(12) << entry.bytes
+               << std::setw(12) << entry.connections
+               << std::setw(12) << entry.capacity
+               << std::setw(12) << entry.max_fan_out
+               << "  " << entry.name << " [" << policy->second << "]\n";
+        }
+    }
+};
+
+//------------------------------------------------------------------------------
+
+/// <summary>
+/// Instrumented Policy
+/// Wraps any threading policy to record per signal counters and timings.
+/// The base policies implement every probe as a no-op so nothing is compiled in without it.
+/// </summary>
+/// <typeparam name="MT_Policy">The threading policy being instrumented</typeparam>
+template <typename MT_Policy>
+class Instrumented : public MT_Policy
+{
+    using Clock = std::chrono::steady_clock;
+    using Counter = std::atomic<std::uint64_t>;
+
+    class Stopwatch final
+    {
+        Counter& total;
+        const char* const name;
+        const bool traced = Trace::enabled();
+        const Clock::time_point start = Clock::now();
+
+        public:
+
+        Stopwatch(Counter& counter, const char* label) : total(counter), name(label)
+        {
+            if (traced)
+            {
+                Trace::record('B', name);
+            }
+        }
+
+        ~Stopwatch()
+        {
+            auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start);
+            total.fetch_add(static_cast<std::uint64_t>(elapsed.count()), std::memory_order_relaxed);
+
+            if (traced)
+            {
+                Trace::record('E', name);
+            }
+        }
+
+        Stopwatch(Stopwatch const&) = delete;
+        Stopwatch& operator= (Stopwatch const&) = delete;
+    };
+
+    struct Counters
+    {
+        Counter fire_count = { 0 };
+        Counter slot_count = { 0 };
+        Counter max_fan_out = { 0 };
+        Counter connections = { 0 };
+        Counter capacity = { 0 };
+        Counter bytes = { 0 };
+        Counter owned_bytes = { 0 };
+        Counter fire_time = { 0 };
+        Counter slot_time = { 0 };
+        Counter lock_wait = { 0 };
+    };
+
+    struct Key_Hash
+    {
+        inline std::size_t operator()(Delegate_Key const& key) const noexcept
+        {
+            return std::hash<std::uintptr_t>()(key[0] ^ (key[1] * 0x9E3779B97F4A7C15ull) ^ (key[2] * 0xC2B2AE3D27D4EB4Full));
+        }
+    };
+
+    class Slot_Stopwatch final
+    {
+        Instrumented const& owner;
+        const Delegate_Key key;
+        const bool traced = Trace::enabled();
+        const Clock::time_point start = Clock::now();
+
+        public:
+
+        Slot_Stopwatch(Instrumented const& instrumented, Delegate_Key const& delegate) :
+            owner(instrumented), key(delegate)
+        {
+            if (traced)
+            {
+                Trace::record('B', nullptr, key[1]);
+            }
+        }
+
+        ~Slot_Stopwatch()
+        {
+            auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start);
+            owner.counters.slot_time.fetch_add(static_cast<std::uint64_t>(elapsed.count()), std::memory_order_relaxed);
+
+            if (owner.profiling.load(std::memory_order_relaxed))
+            {
+                std::lock_guard<Spin_Mutex> lock(owner.profile_mutex);
+                owner.profiles[key].record(elapsed);
+            }
+            if (traced)
+            {
+                Trace::record('E', nullptr, key[1]);
+            }
+        }
+
+        Slot_Stopwatch(Slot_Stopwatch const&) = delete;
+        Slot_Stopwatch& operator= (Slot_Stopwatch const&) = delete;
+    };
+
+    mutable Counters counters;
+    const char* label = "Nano::Signal";
+
+    std::atomic_bool profiling = { false };
+    mutable Spin_Mutex profile_mutex;
+    mutable std::unordered_map<Delegate_Key, Histogram, Key_Hash> profiles;
+
+    static inline Footprint::Entry sample(const void* instance)
+    {
+        auto self = static_cast<Instrumented const*>(instance);
+        auto snapshot = self->statistics();
+
+        Footprint::Entry entry;
+
+        entry.address = instance;
+        entry.name = self->label;
+        entry.policy = typeid(MT_Policy).name();
+        entry.connections = snapshot.connections;
+        entry.capacity = snapshot.capacity;
+        entry.bytes = snapshot.bytes;
+        entry.max_fan_out = snapshot.max_fan_out;
+
+        return entry;
+    }
+
+    // Declared last so that the instance is unlinked before anything else is destroyed
+    Footprint::Link footprint = { this, &Instrumented::sample };
+
+    public:
+
+    inline auto lock_guard() const
+    {
+        // Policies without a mutex have nothing to wait on
+        if constexpr (std::is_same_v<decltype(MT_Policy::lock_guard()), bool>)
+        {
+            return MT_Policy::lock_guard();
+        }
+        // The stopwatch temporary is destroyed only after the lock has been acquired
+        else
+        {
+            return Stopwatch(counters.lock_wait, "lock wait"), MT_Policy::lock_guard();
+        }
+    }
+
+    /// <summary>
+    /// Names the signal in traces, the string must outlive the signal
+    /// </summary>
+    inline void name(const char* signal_name) noexcept
+    {
+        label = signal_name;
+    }
+
+    inline const char* name() const noexcept
+    {
+        return label;
+    }
+
+    inline Statistics statistics() const noexcept
+    {
+        Statistics snapshot;
+
+        snapshot.fire_count = counters.fire_count.load(std::memory_order_relaxed);
+        snapshot.slot_count = counters.slot_count.load(std::memory_order_relaxed);
+        snapshot.max_fan_out = counters.max_fan_out.load(std::memory_order_relaxed);
+        snapshot.connections = counters.connections.load(std::memory_order_relaxed);
+        snapshot.capacity = counters.capacity.load(std::memory_order_relaxed);
+        snapshot.bytes = counters.bytes.load(std::memory_order_relaxed)
+            + counters.owned_bytes.load(std::memory_order_relaxed);
+        snapshot.fire_time = std::chrono::nanoseconds(counters.fire_time.load(std::memory_order_relaxed));
+        snapshot.slot_time = std::chrono::nanoseconds(counters.slot_time.load(std::memory_order_relaxed));
+        snapshot.lock_wait = std::chrono::nanoseconds(counters.lock_wait.load(std::memory_order_relaxed));
+
+        return snapshot;
+    }
+
+    //--------------------------------------------------------------------------
+
+    /// <summary>
+    /// Starts or stops recording a latency histogram for each connected slot
+    /// </summary>
+    inline void profile(bool enabled) noexcept
+    {
+        profiling.store(enabled, std::memory_order_relaxed);
+    }
+
+    inline std::vector<std::pair<Delegate_Key, Histogram>> histograms() const
+    {
+        std::lock_guard<Spin_Mutex> lock(profile_mutex);
+
+        return { std::begin(profiles), std::end(profiles) };
+    }
+
+    /// <summary>
+    /// Writes one line per profiled slot, slowest p99 first, with its resolved symbol
+    /// </summary>
+    inline void dump_profile(std::ostream& os) const
+    {
+        auto slots = histograms();
+
+        std::sort(std::begin(slots), std::end(slots), [](auto const& lhs, auto const& rhs)
+        {
+            return rhs.second.percentile(99) < lhs.second.percentile(99);
+        });
+
+        os << std::setw(12) << "count" << std::setw(12) << "p50 ns" << std::setw(12)
+           << "p99 ns" << std::setw(12) << "max ns" << "  slot\n";
+
+        for (auto const& [key, histogram] : slots)
+        {
+            os << std::setw(12) << histogram.count()
+               << std::setw(12) << histogram.percentile(50).count()
+               << std::setw(12) << histogram.percentile(99).count()
+               << std::setw(12) << histogram.max().count()
+               << "  " << symbol_name(key[1]) << " [" << hex_address(key[0]) << "]\n";
+        }
+    }
+
+    protected:
+
+    Instrumented() noexcept = default;
+    ~Instrumented() noexcept = default;
+
+    //--------------------------------------------------------------------------
+
+    inline auto emission_probe(std::size_t fan_out) const
+    {
+        counters.fire_count.fetch_add(1, std::memory_order_relaxed);
+
+        auto max_fan_out = counters.max_fan_out.load(std::memory_order_relaxed);
+        while (max_fan_out < fan_out && !counters.max_fan_out.compare_exchange_weak(
+            max_fan_out, fan_out, std::memory_order_relaxed))
+        {
+
+        }
+        return Stopwatch(counters.fire_time, label);
+    }
+
+    inline auto slot_probe(Delegate_Key const& key) const
+    {
+        counters.slot_count.fetch_add(1, std::memory_order_relaxed);
+
+        return Slot_Stopwatch(*this, key);
+    }
+
+    inline void resize_probe(std::size_t size, std::size_t capacity, std::size_t bytes) const
+    {
+        counters.connections.store(size, std::memory_order_relaxed);
+        counters.capacity.store(capacity, std::memory_order_relaxed);
+        counters.bytes.store(bytes, std::memory_order_relaxed);
+    }
+
+    // The function objects owned by a signal are reported apart from its connections
+    inline void owned_probe(std::size_t bytes) const
+    {
+        counters.owned_bytes.store(bytes, std::memory_order_relaxed);
+    }
+
+    // The footprint counters are reported again by the moved-to instance itself
+    inline void move_probe(Instrumented& other)
+    {
+        label = other.label;
+
+        for (auto counter : { &Counters::fire_count, &Counters::slot_count, &Counters::max_fan_out,
+            &Counters::fire_time, &Counters::slot_time, &Counters::lock_wait })
+        {
+            (counters.*counter).store((other.counters.*counter).load(std::memory_order_relaxed), std::memory_order_relaxed);
+        }
+        profiling.store(other.profiling.load(std::memory_order_relaxed), std::memory_order_relaxed);
+
+        std::scoped_lock lock(profile_mutex, other.profile_mutex);
+        profiles = std::move(other.profiles);
+        other.profiles.clear();
+    }
+};
+
+} // namespace Nano ------------------------------------------------------------
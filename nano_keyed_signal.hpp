@@ -0,0 +1,233 @@
+#pragma once
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "nano_signal_slot.hpp"
+
+namespace Nano
+{
+
+/// <summary>
+/// Signal whose slots are connected under a key, or a closed range of keys,
+/// so that an emission only reaches the slots registered for its key.
+/// Each key routes to a Nano::Signal of its own found through a hash index,
+/// key ranges are kept sorted by their first key along with the greatest last key up to each of them.
+/// An emission skips the leading ranges that all end before its key and stops at the first starting after it,
+/// ranges between those that do not contain the key are still compared.
+/// Routes are never removed so that emissions may proceed outside the routing lock.
+/// </summary>
+template <typename Key, typename RT, typename MT_Policy = ST_Policy, typename Hash = std::hash<Key>>
+class Keyed_Signal;
+template <typename Key, typename RT, typename... Args, typename MT_Policy, typename Hash>
+class Keyed_Signal<Key, RT(Args...), MT_Policy, Hash> final : private MT_Policy
+{
+    using signal = Signal<RT(Args...), MT_Policy>;
+
+    struct Range
+    {
+        Key first;
+        Key last;
+        // Greatest last key of this range and of every range sorted before it
+        Key reach;
+        signal* route;
+    };
+
+    // Replaced rather than modified so that emissions can walk it without the lock
+    using Range_Index = std::vector<Range>;
+
+    static void update_reach(Range_Index& index, std::size_t from)
+    {
+        for (auto i = from; i < index.size(); ++i)
+        {
+            index[i].reach = i == 0 || index[i - 1].reach < index[i].last
+                ? index[i].last : index[i - 1].reach;
+        }
+    }
+
+    std::unordered_map<Key, std::unique_ptr<signal>, Hash> routes;
+    std::vector<std::unique_ptr<signal>> range_routes;
+    // Sorted by first key
+    std::shared_ptr<const Range_Index> range_index;
+
+    //--------------------------------------------------------------------------
+
+    signal* nolock_find(Key const& key) const
+    {
+        auto found = routes.find(key);
+        return found != std::end(routes) ? found->second.get() : nullptr;
+    }
+
+    signal* find(Key const& key) const
+    {
+        [[maybe_unused]]
+        auto lock = MT_Policy::lock_guard();
+
+        return nolock_find(key);
+    }
+
+    signal* nolock_find_range(Key const& first, Key const& last) const
+    {
+        if (!range_index)
+        {
+            return nullptr;
+        }
+        auto it = std::lower_bound(std::begin(*range_index), std::end(*range_index), first,
+            [](Range const& lhs, Key const& rhs) { return lhs.first < rhs; });
+
+        for (; it != std::end(*range_index) && !(first < it->first); ++it)
+        {
+            if (!(it->last < last) && !(last < it->last))
+            {
+                return it->route;
+            }
+        }
+        return nullptr;
+    }
+
+    signal* find_range(Key const& first, Key const& last) const
+    {
+        [[maybe_unused]]
+        auto lock = MT_Policy::lock_guard();
+
+        return nolock_find_range(first, last);
+    }
+
+    public:
+
+    Keyed_Signal() noexcept = default;
+    ~Keyed_Signal() noexcept = default;
+
+    Keyed_Signal(Keyed_Signal const&) = delete;
+    Keyed_Signal& operator= (Keyed_Signal const&) = delete;
+
+    Keyed_Signal(Keyed_Signal&&) = delete;
+    Keyed_Signal& operator= (Keyed_Signal&&) = delete;
+
+    /// <summary>
+    /// The signal of a key, created upon first use, for use of the full Nano::Signal API
+    /// </summary>
+    signal& route(Key const& key)
+    {
+        [[maybe_unused]]
+        auto lock = MT_Policy::lock_guard();
+
+        auto& found = routes[key];
+        if (!found)
+        {
+            found = std::make_unique<signal>();
+        }
+        return *found;
+    }
+
+    /// <summary>
+    /// The signal of every key from first to last inclusive, created upon first use
+    /// </summary>
+    signal& route(Key const& first, Key const& last)
+    {
+        [[maybe_unused]]
+        auto lock = MT_Policy::lock_guard();
+
+        if (auto found = nolock_find_range(first, last))
+        {
+            return *found;
+        }
+        auto index = range_index ? *range_index : Range_Index();
+
+        auto it = std::lower_bound(std::begin(index), std::end(index), first,
+            [](Range const& lhs, Key const& rhs) { return lhs.first < rhs; });
+
+        range_routes.reserve(range_routes.size() + 1);
+        auto created = std::make_unique<signal>();
+
+        auto at = static_cast<std::size_t>(std::distance(std::begin(index), it));
+        index.insert(it, { first, last, last, created.get() });
+        update_reach(index, at);
+        range_index = std::make_shared<const Range_Index>(std::move(index));
+
+        range_routes.push_back(std::move(created));
+        return *range_routes.back();
+    }
+
+    //-------------------------------------------------------CONNECT / DISCONNECT
+
+    template <auto mem_ptr, typename T>
+    void connect(Key const& key, T& instance)
+    {
+        route(key).template connect<mem_ptr>(instance);
+    }
+
+    template <auto mem_ptr, typename T>
+    void connect(Key const& first, Key const& last, T& instance)
+    {
+        route(first, last).template connect<mem_ptr>(instance);
+    }
+
+    template <auto mem_ptr, typename T>
+    void disconnect(Key const& key, T& instance)
+    {
+        if (auto found = find(key))
+        {
+            found->template disconnect<mem_ptr>(instance);
+        }
+    }
+
+    template <auto mem_ptr, typename T>
+    void disconnect(Key const& first, Key const& last, T& instance)
+    {
+        if (auto found = find_range(first, last))
+        {
+            found->template disconnect<mem_ptr>(instance);
+        }
+    }
+
+    //----------------------------------------------------------------------FIRE
+
+    // Only the slots of this key and of the ranges containing it are emitted
+    template <typename... Uref>
+    void fire(Key const& key, Uref&&... args)
+    {
+        signal* exact = nullptr;
+        std::shared_ptr<const Range_Index> index;
+        {
+            [[maybe_unused]]
+            auto lock = MT_Policy::lock_guard();
+
+            exact = nolock_find(key);
+            index = range_index;
+        }
+        // Without ranges the exact route holds the final slot
+        if (!index)
+        {
+            if (exact)
+            {
+                exact->fire(std::forward<Uref>(args)...);
+            }
+            return;
+        }
+        if (exact)
+        {
+            exact->fire(args...);
+        }
+        // Reach never decreases, so every range before the first reaching the key ends before it
+        auto begin = std::lower_bound(std::begin(*index), std::end(*index), key,
+            [](Range const& lhs, Key const& rhs) { return lhs.reach < rhs; });
+        auto end = std::upper_bound(begin, std::end(*index), key,
+            [](Key const& lhs, Range const& rhs) { return lhs < rhs.first; });
+
+        for (auto it = begin; it != end; ++it)
+        {
+            if (!(it->last < key))
+            {
+                it->route->fire(args...);
+            }
+        }
+    }
+};
+
+} // namespace Nano ------------------------------------------------------------
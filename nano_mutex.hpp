@@ -1,10 +1,25 @@
 #pragma once
 
 #include <atomic>
+#include <cstddef>
 #include <memory>
 #include <mutex>
 #include <thread>
 
+// Define NANO_USDT to compile Linux USDT probes (provider "nano") into connect,
+// disconnect, emission, slot invocation and the TS_Policy_Safe destruction wait.
+// Unattached probes cost a single nop; sys/sdt.h is only needed at build time.
+#if defined(NANO_USDT) && defined(__has_include)
+#if __has_include(<sys/sdt.h>)
+#include <sys/sdt.h>
+#define NANO_PROBE(name, ...) STAP_PROBEV(nano, name, __VA_ARGS__)
+#endif
+#endif
+
+#ifndef NANO_PROBE
+#define NANO_PROBE(name, ...) ((void)0)
+#endif
+
 namespace Nano
 {
 
@@ -105,9 +120,9 @@ class ST_Policy
         return this;
     }
 
-    constexpr auto observed(Weak_Ptr) const
+    constexpr auto observed(Weak_Ptr observer) const
     {
-        return true;
+        return observer;
     }
 
     constexpr auto visiting(Weak_Ptr observer) const
@@ -120,10 +135,45 @@ class ST_Policy
         return observer;
     }
 
+    constexpr auto vacant(Weak_Ptr observer) const
+    {
+        return observer == nullptr;
+    }
+
+    constexpr auto equivalent(Weak_Ptr lhs, Weak_Ptr rhs) const
+    {
+        return lhs == rhs;
+    }
+
     constexpr void before_disconnect_all() const
     {
 
     }
+
+    constexpr auto emission_probe(std::size_t) const
+    {
+        return false;
+    }
+
+    template <typename Key>
+    constexpr auto slot_probe(Key const&) const
+    {
+        return false;
+    }
+
+    constexpr void resize_probe(std::size_t, std::size_t, std::size_t) const
+    {
+
+    }
+    constexpr void owned_probe(std::size_t) const
+    {
+
+    }
+
+    constexpr void move_probe(ST_Policy const&) const
+    {
+
+    }
 };
 
 //------------------------------------------------------------------------------
@@ -194,9 +244,9 @@ class TS_Policy
         return this;
     }
 
-    constexpr auto observed(Weak_Ptr) const
+    constexpr auto observed(Weak_Ptr observer) const
     {
-        return true;
+        return observer;
     }
 
     constexpr auto visiting(Weak_Ptr observer) const
@@ -209,10 +259,45 @@ class TS_Policy
         return observer;
     }
 
+    constexpr auto vacant(Weak_Ptr observer) const
+    {
+        return observer == nullptr;
+    }
+
+    constexpr auto equivalent(Weak_Ptr lhs, Weak_Ptr rhs) const
+    {
+        return lhs == rhs;
+    }
+
     constexpr void before_disconnect_all() const
     {
 
     }
+
+    constexpr auto emission_probe(std::size_t) const
+    {
+        return false;
+    }
+
+    template <typename Key>
+    constexpr auto slot_probe(Key const&) const
+    {
+        return false;
+    }
+
+    constexpr void resize_probe(std::size_t, std::size_t, std::size_t) const
+    {
+
+    }
+    constexpr void owned_probe(std::size_t) const
+    {
+
+    }
+
+    constexpr void move_probe(TS_Policy const&) const
+    {
+
+    }
 };
 
 //------------------------------------------------------------------------------
@@ -262,9 +347,9 @@ class ST_Policy_Safe
         return this;
     }
 
-    constexpr auto observed(Weak_Ptr) const
+    constexpr auto observed(Weak_Ptr observer) const
     {
-        return true;
+        return observer;
     }
 
     constexpr auto visiting(Weak_Ptr observer) const
@@ -277,10 +362,45 @@ class ST_Policy_Safe
         return observer;
     }
 
+    constexpr auto vacant(Weak_Ptr observer) const
+    {
+        return observer == nullptr;
+    }
+
+    constexpr auto equivalent(Weak_Ptr lhs, Weak_Ptr rhs) const
+    {
+        return lhs == rhs;
+    }
+
     constexpr void before_disconnect_all() const
     {
 
     }
+
+    constexpr auto emission_probe(std::size_t) const
+    {
+        return false;
+    }
+
+    template <typename Key>
+    constexpr auto slot_probe(Key const&) const
+    {
+        return false;
+    }
+
+    constexpr void resize_probe(std::size_t, std::size_t, std::size_t) const
+    {
+
+    }
+    constexpr void owned_probe(std::size_t) const
+    {
+
+    }
+
+    constexpr void move_probe(ST_Policy_Safe const&) const
+    {
+
+    }
 };
 
 //------------------------------------------------------------------------------
@@ -372,12 +492,25 @@ class TS_Policy_Safe
         return observer.get();
     }
 
+    inline bool vacant(Weak_Ptr const& observer) const
+    {
+        // Only a reset weak_ptr shares ownership with an empty weak_ptr
+        return !observer.owner_before(Weak_Ptr()) && !Weak_Ptr().owner_before(observer);
+    }
+
+    inline bool equivalent(Weak_Ptr const& lhs, Weak_Ptr const& rhs) const
+    {
+        return !lhs.owner_before(rhs) && !rhs.owner_before(lhs);
+    }
+
     inline void before_disconnect_all()
     {
         // Immediately create a weak ptr so we can "ping" for expiration
         auto ping = weak_ptr();
         // Reset the tracker and then ping for any lingering refs
         tracker.reset();
+
+        NANO_PROBE(wait_entry, this);
         // Wait for all visitors to finish their emissions
         do
         {
@@ -387,6 +520,33 @@ class TS_Policy_Safe
             }
         }
         while (ping.lock());
+
+        NANO_PROBE(wait_return, this);
+    }
+
+    constexpr auto emission_probe(std::size_t) const
+    {
+        return false;
+    }
+
+    template <typename Key>
+    constexpr auto slot_probe(Key const&) const
+    {
+        return false;
+    }
+
+    constexpr void resize_probe(std::size_t, std::size_t, std::size_t) const
+    {
+
+    }
+    constexpr void owned_probe(std::size_t) const
+    {
+
+    }
+
+    constexpr void move_probe(TS_Policy_Safe const&) const
+    {
+
     }
 };
 
@@ -1,38 +1,280 @@
 #pragma once
 
 #include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <iterator>
+#include <mutex>
+#include <optional>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
+#include "nano_combine.hpp"
 #include "nano_function.hpp"
+#include "nano_index.hpp"
 #include "nano_mutex.hpp"
 
 namespace Nano
 {
 
+// Connections without a group are tagged zero
+using Group_Tag = std::uint32_t;
+
+/// <summary>
+/// Remembers every signal connected to within its scopes so that all of those connections
+/// can be disconnected together, one pass per signal, upon disconnect or destruction.
+/// A group and the signals it remembers must not be destroyed concurrently.
+/// </summary>
+class Group final
+{
+    template <typename, typename> friend class Signal;
+
+    struct Member
+    {
+        void* signal;
+        void (*disconnect)(void*, Group*);
+    };
+
+    const Group_Tag id;
+
+    Spin_Mutex mutex;
+    std::vector<Member> members;
+
+    static inline Group_Tag next() noexcept
+    {
+        static std::atomic<Group_Tag> count = { 0 };
+
+        Group_Tag tag = 0;
+        while (!tag)
+        {
+            tag = count.fetch_add(1, std::memory_order_relaxed) + 1;
+        }
+        return tag;
+    }
+
+    // Signals join upon their first connection made within a scope of this group
+    inline void join(void* signal, void (*disconnect)(void*, Group*))
+    {
+        std::lock_guard<Spin_Mutex> lock(mutex);
+
+        for (auto const& member : members)
+        {
+            if (member.signal == signal)
+            {
+                return;
+            }
+        }
+        members.push_back({ signal, disconnect });
+    }
+
+    // Signals leave when destroyed, or rejoin from their new address when moved
+    inline void replace(void* signal, void* moved) noexcept
+    {
+        std::lock_guard<Spin_Mutex> lock(mutex);
+
+        for (auto it = std::begin(members); it != std::end(members); ++it)
+        {
+            if (it->signal == signal)
+            {
+                if (moved)
+                {
+                    it->signal = moved;
+                }
+                else
+                {
+                    members.erase(it);
+                }
+                return;
+            }
+        }
+    }
+
+    public:
+
+    Group() noexcept : id(next()) {}
+    ~Group()
+    {
+        disconnect();
+    }
+
+    Group(Group const&) = delete;
+    Group& operator= (Group const&) = delete;
+
+    inline Group_Tag tag() const noexcept
+    {
+        return id;
+    }
+
+    /// <summary>
+    /// Disconnects every slot connected within a scope of this group from every signal it remembers
+    /// </summary>
+    inline void disconnect() noexcept
+    {
+        std::lock_guard<Spin_Mutex> lock(mutex);
+
+        for (auto const& member : members)
+        {
+            member.disconnect(member.signal, this);
+        }
+        members.clear();
+    }
+};
+
+//------------------------------------------------------------------------------
+
+/// <summary>
+/// Adds every connection made by the current thread within its scope to the group.
+/// Scopes may nest, the innermost group applies.
+/// </summary>
+class Group_Scope final
+{
+    template <typename> friend class Observer;
+    template <typename, typename> friend class Signal;
+
+    inline static thread_local Group* current = nullptr;
+
+    Group* const previous;
+
+    static inline Group_Tag current_tag() noexcept
+    {
+        return current ? current->tag() : 0;
+    }
+
+    public:
+
+    explicit Group_Scope(Group& group) noexcept : previous(std::exchange(current, &group)) {}
+    ~Group_Scope()
+    {
+        current = previous;
+    }
+
+    Group_Scope(Group_Scope const&) = delete;
+    Group_Scope& operator= (Group_Scope const&) = delete;
+};
+
+//------------------------------------------------------------------------------
+
+/// <summary>
+/// Mutes or unmutes a connection with a single store, without locking or looking it up.
+/// Valid for as long as the connection it was obtained for stays connected.
+/// </summary>
+class Mute_Handle final
+{
+    template <typename> friend class Observer;
+
+    std::atomic_bool* flag = nullptr;
+
+    explicit Mute_Handle(std::atomic_bool* muted) noexcept : flag(muted) {}
+
+    public:
+
+    Mute_Handle() noexcept = default;
+
+    inline void mute() const noexcept
+    {
+        if (flag)
+        {
+            flag->store(true, std::memory_order_relaxed);
+        }
+    }
+
+    inline void unmute() const noexcept
+    {
+        if (flag)
+        {
+            flag->store(false, std::memory_order_relaxed);
+        }
+    }
+
+    inline bool is_muted() const noexcept
+    {
+        return flag && flag->load(std::memory_order_relaxed);
+    }
+
+    // False if the key was not connected when the handle was obtained
+    explicit inline operator bool() const noexcept
+    {
+        return flag != nullptr;
+    }
+};
+
+//------------------------------------------------------------------------------
+
 template <typename MT_Policy = ST_Policy>
 class Observer : private MT_Policy
 {
     // Only Nano::Signal is allowed private access
     template <typename, typename> friend class Signal;
 
+    // Mute flags live apart from the connections so that handles survive merges and compaction
+    struct Mute_Cell
+    {
+        std::atomic_bool muted = { false };
+        // Connections sharing the cell, or the next free cell, only accessed under lock
+        std::uint32_t users = 0;
+        std::uint32_t next = 0;
+    };
+
+    // Chunk k holds 64 << k cells so that cells never move and the directory never grows
+    static constexpr std::size_t mute_chunk_bits = 6;
+    static constexpr std::size_t mute_chunk_count = 26;
+
+    struct Mute_Table
+    {
+        // Safe policies read the directory from emissions running outside the lock
+        std::array<std::atomic<Mute_Cell*>, mute_chunk_count> chunks {};
+        std::uint32_t cells = 0;
+        std::uint32_t free_cells = 0;
+
+        ~Mute_Table()
+        {
+            for (auto& chunk : chunks)
+            {
+                delete[] chunk.load(std::memory_order_relaxed);
+            }
+        }
+
+        std::size_t footprint_bytes() const noexcept
+        {
+            auto bytes = sizeof(Mute_Table);
+
+            for (std::size_t k = 0; k < mute_chunk_count && chunks[k].load(std::memory_order_relaxed); ++k)
+            {
+                bytes += (std::size_t(1) << (k + mute_chunk_bits)) * sizeof(Mute_Cell);
+            }
+            return bytes;
+        }
+    };
+
     struct Connection
     {
         Delegate_Key delegate;
         typename MT_Policy::Weak_Ptr observer;
+        // One based index of the mute cell, zero until a mute handle is obtained
+        std::uint32_t mute = 0;
+        Group_Tag group = 0;
+        // Stable id of this connection and of its mirror at the other end, zero when it has none
+        std::uint32_t id = 0;
+        std::uint32_t link = 0;
 
         Connection() noexcept = default;
         Connection(Delegate_Key const& key) : delegate(key), observer() {}
-        Connection(Delegate_Key const& key, Observer* obs) : delegate(key), observer(obs->weak_ptr()) {}
+        Connection(Delegate_Key const& key, Observer* obs) :
+            delegate(key), observer(obs->weak_ptr()), group(Group_Scope::current_tag()) {}
     };
 
-    struct Z_Order
+    struct Thunk_Order
     {
+        // Grouping by thunk first lets emission call the same target over a run of instances
         inline bool operator()(Delegate_Key const& lhs, Delegate_Key const& rhs) const
         {
-            std::size_t x = lhs[0] ^ rhs[0];
-            std::size_t y = lhs[1] ^ rhs[1];
-            auto k = (x < y) && x < (x ^ y);
-            return lhs[k] < rhs[k];
+            if (lhs[1] != rhs[1])
+            {
+                return lhs[1] < rhs[1];
+            }
+            return lhs[0] < rhs[0] || (lhs[0] == rhs[0] && lhs[2] < rhs[2]);
         }
 
         inline bool operator()(Connection const& lhs, Connection const& rhs) const
@@ -41,16 +283,159 @@ class Observer : private MT_Policy
         }
     };
 
+    template <typename P, typename = void>
+    struct Is_Indexed : std::false_type {};
+    template <typename P>
+    struct Is_Indexed<P, std::void_t<decltype(P::indexed)>> : std::bool_constant<P::indexed> {};
+
+    // Policies such as Nano::Indexed keep a Flat_Index of the connections
+    static constexpr bool indexed = Is_Indexed<MT_Policy>::value;
+
     std::vector<Connection> connections;
+    std::size_t tombstones = 0;
+    // Connections past this prefix were appended and are yet to be merged
+    std::size_t sorted = 0;
+
+    // Position of each connection by id, unused ids chain the next free id
+    std::vector<std::uint32_t> positions;
+    std::uint32_t free_ids = 0;
+
+    // Allocated by the first mute handle so that observers which never mute only pay for a pointer
+    std::atomic<Mute_Table*> mutes = { nullptr };
 
     //--------------------------------------------------------------------------
 
     void nolock_insert(Delegate_Key const& key, Observer* obs)
     {
-        auto begin = std::begin(connections);
-        auto end = std::end(connections);
+        if constexpr (indexed)
+        {
+            // Reserve both up front so that they cannot fall out of step
+            MT_Policy::flat_index.reserve(connections.size() + 1);
+            connections.emplace_back(key, obs);
+            MT_Policy::flat_index.insert(key, connections.size() - 1);
+        }
+        else
+        {
+            // Appending keeps bursts of connections O(1), lookups and emissions merge the tail on demand
+            connections.emplace_back(key, obs);
+        }
+        nolock_resize_probe();
+    }
 
-        connections.emplace(std::upper_bound(begin, end, key, Z_Order()), key, obs);
+    std::uint32_t nolock_acquire_id()
+    {
+        if (free_ids)
+        {
+            return std::exchange(free_ids, positions[free_ids - 1]);
+        }
+        positions.push_back(0);
+        return static_cast<std::uint32_t>(positions.size());
+    }
+
+    void nolock_reposition() noexcept
+    {
+        for (std::size_t i = 0; i < connections.size(); ++i)
+        {
+            if (auto id = connections[i].id)
+            {
+                positions[id - 1] = static_cast<std::uint32_t>(i);
+            }
+        }
+    }
+
+    // Merges two sorted runs by rotation, unlike std::inplace_merge it never allocates a buffer
+    template <typename It>
+    static void merge_in_place(It first, It middle, It last, std::size_t lhs, std::size_t rhs) noexcept
+    {
+        if (lhs == 0 || rhs == 0)
+        {
+            return;
+        }
+        if (lhs + rhs == 2)
+        {
+            if (Thunk_Order()(*middle, *first))
+            {
+                std::iter_swap(first, middle);
+            }
+            return;
+        }
+        auto lhs_cut = first;
+        auto rhs_cut = middle;
+
+        // Split the longer run in half and the other one where that half belongs
+        if (lhs > rhs)
+        {
+            lhs_cut = std::next(first, lhs / 2);
+            rhs_cut = std::lower_bound(middle, last, *lhs_cut, Thunk_Order());
+        }
+        else
+        {
+            rhs_cut = std::next(middle, rhs / 2);
+            lhs_cut = std::upper_bound(first, middle, *rhs_cut, Thunk_Order());
+        }
+        auto lhs_head = std::size_t(std::distance(first, lhs_cut));
+        auto rhs_head = std::size_t(std::distance(middle, rhs_cut));
+        auto split = std::rotate(lhs_cut, middle, rhs_cut);
+
+        merge_in_place(first, lhs_cut, split, lhs_head, rhs_head);
+        merge_in_place(split, rhs_cut, last, lhs - lhs_head, rhs - rhs_head);
+    }
+
+    void nolock_merge() noexcept
+    {
+        if constexpr (!indexed)
+        {
+            if (sorted == connections.size())
+            {
+                return;
+            }
+            auto begin = std::begin(connections);
+            auto middle = std::next(begin, sorted);
+            auto end = std::end(connections);
+
+            std::sort(middle, end, Thunk_Order());
+            merge_in_place(begin, middle, end, sorted, connections.size() - sorted);
+
+            sorted = connections.size();
+            nolock_reposition();
+        }
+    }
+
+    void nolock_reindex() noexcept
+    {
+        if constexpr (indexed)
+        {
+            MT_Policy::flat_index.clear();
+
+            for (std::size_t i = 0; i < connections.size(); ++i)
+            {
+                if (!MT_Policy::vacant(connections[i].observer))
+                {
+                    MT_Policy::flat_index.insert(connections[i].delegate, i);
+                }
+            }
+        }
+    }
+
+    // Everything held for the connections, owned function objects are reported by the signal
+    std::size_t nolock_footprint_bytes() const noexcept
+    {
+        auto bytes = connections.capacity() * sizeof(Connection) + positions.capacity() * sizeof(std::uint32_t);
+
+        if (auto table = mutes.load(std::memory_order_relaxed))
+        {
+            bytes += table->footprint_bytes();
+        }
+        if constexpr (indexed)
+        {
+            bytes += MT_Policy::flat_index.footprint_bytes();
+        }
+        return bytes;
+    }
+
+    void nolock_resize_probe() const noexcept
+    {
+        MT_Policy::resize_probe(connections.size() - tombstones, connections.capacity(), nolock_footprint_bytes());
     }
 
     void insert(Delegate_Key const& key, Observer* obs)
@@ -59,6 +444,122 @@ class Observer : private MT_Policy
         auto lock = MT_Policy::lock_guard();
 
         nolock_insert(key, obs);
+
+        NANO_PROBE(connect, this, connections.size() - tombstones, key[0], key[1], key[2]);
+    }
+
+    // Inserts a connection with an id by which the other end can find it
+    std::uint32_t insert(Delegate_Key const& key, Observer* obs, std::uint32_t link)
+    {
+        [[maybe_unused]]
+        auto lock = MT_Policy::lock_guard();
+
+        // Acquired first so that a failed insert only has the id to give back
+        auto id = nolock_acquire_id();
+
+        try
+        {
+            nolock_insert(key, obs);
+        }
+        catch (...)
+        {
+            positions[id - 1] = std::exchange(free_ids, id);
+            throw;
+        }
+        auto& slot = connections.back();
+
+        slot.id = id;
+        slot.link = link;
+        positions[id - 1] = static_cast<std::uint32_t>(connections.size() - 1);
+
+        NANO_PROBE(connect, this, connections.size() - tombstones, key[0], key[1], key[2]);
+
+        return id;
+    }
+
+    // Connects the key at both ends with each connection linked to its mirror
+    void insert_linked(Delegate_Key const& key, Observer* obs)
+    {
+        auto id = insert(key, obs, 0);
+        auto link = obs->insert(key, this, id);
+
+        [[maybe_unused]]
+        auto lock = MT_Policy::lock_guard();
+
+        if (auto slot = nolock_linked(id, 0, key))
+        {
+            slot->link = link;
+        }
+    }
+
+    // The live connection of the id if it still pairs with the link
+    Connection* nolock_linked(std::uint32_t id, std::uint32_t link, Delegate_Key const& key) noexcept
+    {
+        if (id == 0 || id > positions.size() || positions[id - 1] >= connections.size())
+        {
+            return nullptr;
+        }
+        auto& slot = connections[positions[id - 1]];
+
+        if (slot.id != id || slot.link != link || slot.delegate != key || MT_Policy::vacant(slot.observer))
+        {
+            return nullptr;
+        }
+        return &slot;
+    }
+
+    template <typename Visit>
+    void nolock_remove(Delegate_Key const& key, Visit&& visit) noexcept
+    {
+        auto tombstone = [&](Connection& slot)
+        {
+            if (!MT_Policy::vacant(slot.observer))
+            {
+                visit(slot);
+                slot.observer = {};
+                ++tombstones;
+            }
+        };
+
+        // Tombstone the matching slots instead of shifting the tail on every removal
+        if constexpr (indexed)
+        {
+            auto match = [&](std::size_t i) { return connections[i].delegate == key; };
+
+            for (auto i = MT_Policy::flat_index.find(key, match); i != Flat_Index::npos;
+                i = MT_Policy::flat_index.find(key, match))
+            {
+                MT_Policy::flat_index.erase(key, i);
+                tombstone(connections[i]);
+            }
+        }
+        else
+        {
+            nolock_merge();
+
+            auto begin = std::begin(connections);
+            auto end = std::end(connections);
+
+            auto slots = std::equal_range(begin, end, key, Thunk_Order());
+
+            for (auto it = slots.first; it != slots.second; ++it)
+            {
+                tombstone(*it);
+            }
+        }
+        nolock_removed(key);
+    }
+
+    void nolock_removed([[maybe_unused]] Delegate_Key const& key) noexcept
+    {
+        // Sweep once the dead outnumber the living so erasure stays amortized O(1)
+        if (tombstones * 2 > connections.size())
+        {
+            nolock_compact();
+        }
+        nolock_resize_probe();
+
+        NANO_PROBE(disconnect, this, connections.size() - tombstones, key[0], key[1], key[2]);
     }
 
     void remove(Delegate_Key const& key) noexcept
@@ -66,11 +567,284 @@ class Observer : private MT_Policy
         [[maybe_unused]]
         auto lock = MT_Policy::lock_guard();
 
+        nolock_remove(key, [](Connection const&) {});
+    }
+
+    // Removes only the mirror of a connection being torn down, found through its id in O(1)
+    void remove_linked(std::uint32_t id, std::uint32_t link, Delegate_Key const& key) noexcept
+    {
+        [[maybe_unused]]
+        auto lock = MT_Policy::lock_guard();
+
+        // A mismatch means the mirror is already gone and its id may have been reused
+        if (auto slot = nolock_linked(id, link, key))
+        {
+            if constexpr (indexed)
+            {
+                MT_Policy::flat_index.erase(key, positions[id - 1]);
+            }
+            slot->observer = {};
+            ++tombstones;
+
+            nolock_removed(key);
+        }
+    }
+
+    // Removes the key from both ends of each of its connections
+    void nolock_disconnect(Delegate_Key const& key) noexcept
+    {
+        nolock_remove(key, [this](Connection const& slot)
+        {
+            nolock_unlink(slot);
+        });
+    }
+
+    void nolock_unlink(Connection const& slot) noexcept
+    {
+        if (auto observed = MT_Policy::visiting(slot.observer))
+        {
+            auto ptr = static_cast<Observer*>(MT_Policy::unmask(observed));
+
+            // Connections made before linking, or still being linked, fall back to the key
+            if (slot.link)
+            {
+                ptr->remove_linked(slot.link, slot.id, slot.delegate);
+            }
+            else
+            {
+                ptr->remove(slot.delegate);
+            }
+        }
+    }
+
+    void relink(Delegate_Key const& key, Observer* from, Observer* to) noexcept
+    {
+        [[maybe_unused]]
+        auto lock = MT_Policy::lock_guard();
+
+        auto previous = from->weak_ptr();
+
+        // Only the observer changed so the slots can be rewritten in place
+        if constexpr (indexed)
+        {
+            auto match = [&](std::size_t i)
+            {
+                return connections[i].delegate == key && MT_Policy::equivalent(connections[i].observer, previous);
+            };
+
+            for (auto i = MT_Policy::flat_index.find(key, match); i != Flat_Index::npos;
+                i = MT_Policy::flat_index.find(key, match))
+            {
+                connections[i].observer = to->weak_ptr();
+            }
+        }
+        else
+        {
+            nolock_merge();
+
+            auto begin = std::begin(connections);
+            auto end = std::end(connections);
+
+            auto slots = std::equal_range(begin, end, key, Thunk_Order());
+
+            for (auto it = slots.first; it != slots.second; ++it)
+            {
+                if (MT_Policy::equivalent(it->observer, previous))
+                {
+                    it->observer = to->weak_ptr();
+                }
+            }
+        }
+    }
+
+    // Disconnects every slot of the group in one pass, visiting each before it is tombstoned
+    template <typename Visit>
+    void nolock_disconnect_group(Group_Tag tag, Visit&& visit) noexcept
+    {
+        for (std::size_t i = 0; i < connections.size(); ++i)
+        {
+            auto& slot = connections[i];
+
+            if (slot.group != tag || MT_Policy::vacant(slot.observer))
+            {
+                continue;
+            }
+            if constexpr (indexed)
+            {
+                MT_Policy::flat_index.erase(slot.delegate, i);
+            }
+            nolock_unlink(slot);
+            visit(slot);
+
+            slot.observer = {};
+            ++tombstones;
+        }
+        if (tombstones * 2 > connections.size())
+        {
+            nolock_compact();
+        }
+        nolock_resize_probe();
+    }
+
+    //--------------------------------------------------------------------------
+
+    static inline std::pair<std::size_t, std::size_t> mute_locate(std::uint32_t cell) noexcept
+    {
+        auto position = std::size_t(cell - 1) + (std::size_t(1) << mute_chunk_bits);
+
+        std::size_t chunk = 0;
+        while (position >> (chunk + mute_chunk_bits + 1))
+        {
+            ++chunk;
+        }
+        return { chunk, position - (std::size_t(1) << (chunk + mute_chunk_bits)) };
+    }
+
+    inline Mute_Cell& mute_cell(std::uint32_t cell) const noexcept
+    {
+        auto [chunk, offset] = mute_locate(cell);
+        return mutes.load(std::memory_order_acquire)->chunks[chunk].load(std::memory_order_acquire)[offset];
+    }
+
+    inline bool nolock_muted(Connection const& slot) const noexcept
+    {
+        return slot.mute && mute_cell(slot.mute).muted.load(std::memory_order_relaxed);
+    }
+
+    std::uint32_t nolock_acquire_mute_cell()
+    {
+        auto table = mutes.load(std::memory_order_relaxed);
+
+        if (!table)
+        {
+            table = new Mute_Table;
+            mutes.store(table, std::memory_order_release);
+        }
+        if (table->free_cells)
+        {
+            return std::exchange(table->free_cells, mute_cell(table->free_cells).next);
+        }
+        auto cell = table->cells + 1;
+        auto [chunk, offset] = mute_locate(cell);
+
+        if (offset == 0)
+        {
+            table->chunks[chunk].store(new Mute_Cell[std::size_t(1) << (chunk + mute_chunk_bits)],
+                std::memory_order_release);
+        }
+        return table->cells = cell;
+    }
+
+    void nolock_release_mute_cell(Connection& slot) noexcept
+    {
+        if (auto cell = std::exchange(slot.mute, 0))
+        {
+            auto& released = mute_cell(cell);
+
+            if (--released.users == 0)
+            {
+                released.muted.store(false, std::memory_order_relaxed);
+                released.next = std::exchange(mutes.load(std::memory_order_relaxed)->free_cells, cell);
+            }
+        }
+    }
+
+    void release_mute_table() noexcept
+    {
+        delete mutes.exchange(nullptr, std::memory_order_relaxed);
+    }
+
+    template <typename Visit>
+    void nolock_for_each_of(Delegate_Key const& key, Visit&& visit)
+    {
+        if constexpr (indexed)
+        {
+            // Visits each position of the key while matching none of them
+            MT_Policy::flat_index.find(key, [&](std::size_t i)
+            {
+                if (connections[i].delegate == key)
+                {
+                    visit(connections[i]);
+                }
+                return false;
+            });
+        }
+        else
+        {
+            nolock_merge();
+
+            auto slots = std::equal_range(std::begin(connections), std::end(connections), key, Thunk_Order());
+
+            for (auto it = slots.first; it != slots.second; ++it)
+            {
+                visit(*it);
+            }
+        }
+    }
+
+    // Every connection of the key shares the mute cell of the handle
+    Mute_Handle mute_handle(Delegate_Key const& key)
+    {
+        [[maybe_unused]]
+        auto lock = MT_Policy::lock_guard();
+
+        std::uint32_t cell = 0;
+        bool connected = false;
+
+        nolock_for_each_of(key, [&](Connection const& slot)
+        {
+            if (!MT_Policy::vacant(slot.observer))
+            {
+                connected = true;
+                cell = slot.mute ? slot.mute : cell;
+            }
+        });
+        if (!connected)
+        {
+            return {};
+        }
+        if (!cell)
+        {
+            cell = nolock_acquire_mute_cell();
+            nolock_resize_probe();
+        }
+        nolock_for_each_of(key, [&](Connection& slot)
+        {
+            if (!MT_Policy::vacant(slot.observer) && !slot.mute)
+            {
+                slot.mute = cell;
+                ++mute_cell(cell).users;
+            }
+        });
+        return Mute_Handle(&mute_cell(cell).muted);
+    }
+
+    void nolock_compact() noexcept
+    {
+        nolock_merge();
+
         auto begin = std::begin(connections);
         auto end = std::end(connections);
 
-        auto slots = std::equal_range(begin, end, key, Z_Order());
-        connections.erase(slots.first, slots.second);
+        connections.erase(std::remove_if(begin, end, [this](Connection& slot)
+        {
+            if (MT_Policy::vacant(slot.observer))
+            {
+                nolock_release_mute_cell(slot);
+                if (slot.id)
+                {
+                    positions[slot.id - 1] = std::exchange(free_ids, slot.id);
+                }
+                return true;
+            }
+            return false;
+        }), end);
+
+        tombstones = 0;
+        sorted = connections.size();
+
+        nolock_reposition();
+        nolock_reindex();
     }
 
     //--------------------------------------------------------------------------
@@ -81,44 +855,138 @@ class Observer : private MT_Policy
         [[maybe_unused]]
         auto lock = MT_Policy::lock_guard();
 
-        for (auto const& slot : MT_Policy::copy_or_ref(connections, lock))
+        [[maybe_unused]]
+        auto fan_out = connections.size() - tombstones;
+
+        [[maybe_unused]]
+        auto probe = MT_Policy::emission_probe(fan_out);
+
+        // The first emission after a burst of connections merges them in place, without allocating
+        nolock_merge();
+
+        auto&& slots = MT_Policy::copy_or_ref(connections, lock);
+
+        NANO_PROBE(fire_entry, this, fan_out);
+
+        for (auto it = std::begin(slots), end = std::end(slots); it != end; ++it)
         {
-            if (auto observer = MT_Policy::observed(slot.observer))
+            if (nolock_muted(*it))
             {
-                Function::bind(slot.delegate)(args...);
+                continue;
+            }
+            if (auto observer = MT_Policy::observed(it->observer))
+            {
+                [[maybe_unused]]
+                auto slot_scope = MT_Policy::slot_probe(it->delegate);
+
+                NANO_PROBE(slot_entry, this, it->delegate[0], it->delegate[1], it->delegate[2]);
+
+                // Only the final slot may consume the arguments
+                if (std::next(it) == end)
+                {
+                    Function::bind(it->delegate)(std::forward<Uref>(args)...);
+                }
+                else
+                {
+                    Function::bind(it->delegate)(args...);
+                }
+
+                NANO_PROBE(slot_return, this, it->delegate[0], it->delegate[1], it->delegate[2]);
             }
         }
+
+        NANO_PROBE(fire_return, this, fan_out);
     }
 
     template <typename Function, typename Accumulate, typename... Uref>
-    void for_each_accumulate(Accumulate&& accumulate, Uref&&... args)
+    std::optional<Delegate_Key> for_each_accumulate(Accumulate&& accumulate, Uref&&... args)
     {
         [[maybe_unused]]
         auto lock = MT_Policy::lock_guard();
 
-        for (auto const& slot : MT_Policy::copy_or_ref(connections, lock))
+        [[maybe_unused]]
+        auto fan_out = connections.size() - tombstones;
+
+        [[maybe_unused]]
+        auto probe = MT_Policy::emission_probe(fan_out);
+
+        // The first emission after a burst of connections merges them in place, without allocating
+        nolock_merge();
+
+        auto&& slots = MT_Policy::copy_or_ref(connections, lock);
+
+        NANO_PROBE(fire_entry, this, fan_out);
+
+        for (auto it = std::begin(slots), end = std::end(slots); it != end; ++it)
         {
-            if (auto observer = MT_Policy::observed(slot.observer))
+            if (nolock_muted(*it))
+            {
+                continue;
+            }
+            if (auto observer = MT_Policy::observed(it->observer))
             {
-                accumulate(Function::bind(slot.delegate)(args...));
+                auto invoke = [&]() -> decltype(auto)
+                {
+                    [[maybe_unused]]
+                    auto slot_scope = MT_Policy::slot_probe(it->delegate);
+
+                    NANO_PROBE(slot_entry, this, it->delegate[0], it->delegate[1], it->delegate[2]);
+
+                    // Only the final slot may consume the arguments
+                    if (std::next(it) == end)
+                    {
+                        return Function::bind(it->delegate)(std::forward<Uref>(args)...);
+                    }
+                    return Function::bind(it->delegate)(args...);
+                };
+
+                // Accumulators returning Nano::Flow decide whether the emission continues
+                if constexpr (std::is_same_v<decltype(accumulate(invoke())), Flow>)
+                {
+                    if (accumulate(invoke()) == Flow::Stop)
+                    {
+                        NANO_PROBE(slot_return, this, it->delegate[0], it->delegate[1], it->delegate[2]);
+                        NANO_PROBE(fire_return, this, fan_out);
+
+                        return it->delegate;
+                    }
+                }
+                else
+                {
+                    accumulate(invoke());
+                }
+
+                NANO_PROBE(slot_return, this, it->delegate[0], it->delegate[1], it->delegate[2]);
             }
         }
+
+        NANO_PROBE(fire_return, this, fan_out);
+
+        return std::nullopt;
     }
 
     //--------------------------------------------------------------------------
 
     void nolock_disconnect_all() noexcept
     {
-        for (auto const& slot : connections)
+        for (auto& slot : connections)
         {
-            if (auto observed = MT_Policy::visiting(slot.observer))
-            {
-                auto ptr = static_cast<Observer*>(MT_Policy::unmask(observed));
-                ptr->remove(slot.delegate);
-            }
+            nolock_unlink(slot);
+            nolock_release_mute_cell(slot);
         }
 
         connections.clear();
+        tombstones = 0;
+        sorted = 0;
+
+        positions.clear();
+        free_ids = 0;
+
+        if constexpr (indexed)
+        {
+            MT_Policy::flat_index.clear();
+        }
+        nolock_resize_probe();
     }
 
     void move_connections_from(Observer* other) noexcept
@@ -129,24 +997,54 @@ class Observer : private MT_Policy
         // Make sure this is disconnected and ready to receive
         nolock_disconnect_all();
 
-        // Disconnect other from everyone else and connect them to this
-        for (auto const& slot : other->connections)
+        // Instrumented policies carry their name and counters across
+        MT_Policy::move_probe(static_cast<MT_Policy&>(*other));
+
+        // Point everyone other is connected to at this instead
+        for (auto& slot : other->connections)
         {
             if (auto observed = other->visiting(slot.observer))
             {
                 auto ptr = static_cast<Observer*>(MT_Policy::unmask(observed));
-                ptr->remove(slot.delegate);
-                ptr->insert(slot.delegate, this);
-                nolock_insert(slot.delegate, ptr);
+                ptr->relink(slot.delegate, other, this);
             }
-            // Connect free functions and function objects
-            else
+            // Free functions and function objects refer back to their owner
+            else if (MT_Policy::equivalent(slot.observer, other->weak_ptr()))
+            {
+                slot.observer = MT_Policy::weak_ptr();
+            }
+            // Whatever remains belongs to an observer that is already going away
+            else if (!MT_Policy::vacant(slot.observer))
             {
-                nolock_insert(slot.delegate, this);
+                slot.observer = {};
+                ++other->tombstones;
             }
         }
 
+        // The sort order is unaffected so steal the buffer wholesale
+        connections = std::move(other->connections);
+        tombstones = std::exchange(other->tombstones, 0);
+        sorted = std::exchange(other->sorted, 0);
+
+        // The ids move along so that the links of everyone relinked above still hold
+        positions = std::move(other->positions);
+        free_ids = std::exchange(other->free_ids, 0);
+        other->positions.clear();
+
+        // Mute cells are taken along so that handles remain valid
+        release_mute_table();
+        mutes.store(other->mutes.exchange(nullptr, std::memory_order_relaxed), std::memory_order_relaxed);
+
         other->connections.clear();
+
+        if constexpr (indexed)
+        {
+            MT_Policy::flat_index = std::move(other->flat_index);
+            other->flat_index.clear();
+        }
+
+        nolock_resize_probe();
+        other->nolock_resize_probe();
     }
 
     //--------------------------------------------------------------------------
@@ -166,7 +1064,79 @@ class Observer : private MT_Policy
         [[maybe_unused]]
         auto lock = MT_Policy::lock_guard();
 
-        return connections.empty();
+        return connections.size() == tombstones;
+    }
+
+    void reserve(std::size_t capacity)
+    {
+        [[maybe_unused]]
+        auto lock = MT_Policy::lock_guard();
+
+        connections.reserve(capacity);
+
+        if constexpr (indexed)
+        {
+            MT_Policy::flat_index.reserve(capacity);
+        }
+        nolock_resize_probe();
+    }
+
+    void shrink_to_fit()
+    {
+        [[maybe_unused]]
+        auto lock = MT_Policy::lock_guard();
+
+        // Sweep the tombstones first so that they are not kept alive by the new buffer
+        nolock_compact();
+        connections.shrink_to_fit();
+
+        if constexpr (indexed)
+        {
+            MT_Policy::flat_index = Flat_Index();
+            MT_Policy::flat_index.reserve(connections.size());
+            nolock_reindex();
+        }
+
+        nolock_resize_probe();
+    }
+
+    //--------------------------------------------------------------------------
+    // Only available when using an instrumented policy such as Nano::Instrumented
+
+    template <typename P = MT_Policy>
+    auto name(const char* signal_name) noexcept -> decltype(std::declval<P&>().name(signal_name))
+    {
+        return MT_Policy::name(signal_name);
+    }
+
+    template <typename P = MT_Policy>
+    auto name() const noexcept -> decltype(std::declval<P const&>().name())
+    {
+        return MT_Policy::name();
+    }
+
+    template <typename P = MT_Policy>
+    auto statistics() const noexcept -> decltype(std::declval<P const&>().statistics())
+    {
+        return MT_Policy::statistics();
+    }
+
+    template <typename P = MT_Policy>
+    auto profile(bool enabled) noexcept -> decltype(std::declval<P&>().profile(enabled))
+    {
+        return MT_Policy::profile(enabled);
+    }
+
+    template <typename P = MT_Policy>
+    auto histograms() const -> decltype(std::declval<P const&>().histograms())
+    {
+        return MT_Policy::histograms();
+    }
+
+    template <typename Ostream, typename P = MT_Policy>
+    auto dump_profile(Ostream& os) const -> decltype(std::declval<P const&>().dump_profile(os))
+    {
+        return MT_Policy::dump_profile(os);
     }
 
     protected:
@@ -178,6 +1148,7 @@ class Observer : private MT_Policy
         MT_Policy::before_disconnect_all();
 
         disconnect_all();
+        release_mute_table();
     }
 
     Observer() noexcept = default;
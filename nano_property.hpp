@@ -0,0 +1,295 @@
+#pragma once
+
+#include <cstddef>
+#include <optional>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "nano_signal_slot.hpp"
+
+namespace Nano
+{
+
+/// <summary>
+/// Commits many dirty properties in one pass, typically once per scheduler tick.
+/// Properties enqueue themselves the first time they become dirty and leave when destroyed,
+/// a property destroyed while another thread commits it waits for that commit to finish.
+/// The batch must outlive the properties constructed with it.
+/// </summary>
+template <typename MT_Policy = ST_Policy>
+class Property_Batch final : private MT_Policy
+{
+    template <typename, typename>
+    friend class Property;
+
+    using Commit = void(*)(void*);
+
+    struct Pending
+    {
+        void* property;
+        Commit commit;
+    };
+
+    std::vector<Pending> pending;
+    // The property being committed outside the lock, which must not be destroyed meanwhile
+    void* in_flight = nullptr;
+
+    //--------------------------------------------------------------------------
+
+    void enqueue(void* property, Commit commit)
+    {
+        [[maybe_unused]]
+        auto lock = MT_Policy::lock_guard();
+
+        pending.push_back({ property, commit });
+    }
+
+    // Entries are only searched for while queued, a commit in flight is waited for regardless
+    void dequeue(void* property, bool queued) noexcept
+    {
+        for (;;)
+        {
+            {
+                [[maybe_unused]]
+                auto lock = MT_Policy::lock_guard();
+
+                // Cleared rather than erased as a commit may be iterating
+                for (auto& entry : pending)
+                {
+                    if (queued && entry.property == property)
+                    {
+                        entry.property = nullptr;
+                    }
+                }
+                if (in_flight != property)
+                {
+                    return;
+                }
+            }
+            std::this_thread::yield();
+        }
+    }
+
+    void settle() noexcept
+    {
+        [[maybe_unused]]
+        auto lock = MT_Policy::lock_guard();
+
+        in_flight = nullptr;
+    }
+
+    public:
+
+    Property_Batch() noexcept = default;
+    ~Property_Batch() noexcept = default;
+
+    Property_Batch(Property_Batch const&) = delete;
+    Property_Batch& operator= (Property_Batch const&) = delete;
+
+    Property_Batch(Property_Batch&&) = delete;
+    Property_Batch& operator= (Property_Batch&&) = delete;
+
+    bool is_empty() const
+    {
+        [[maybe_unused]]
+        auto lock = MT_Policy::lock_guard();
+
+        return pending.empty();
+    }
+
+    // Notifies every dirty property once with its final value, in the order they became dirty.
+    // A batch is committed by one thread at a time, and no property may be destroyed by its own slots.
+    void commit()
+    {
+        for (std::size_t i = 0; ; ++i)
+        {
+            Pending next = { nullptr, nullptr };
+            {
+                [[maybe_unused]]
+                auto lock = MT_Policy::lock_guard();
+
+                if (i >= pending.size())
+                {
+                    pending.clear();
+                    in_flight = nullptr;
+                    return;
+                }
+                next = std::exchange(pending[i], { nullptr, nullptr });
+                in_flight = next.property;
+            }
+            // Slots are invoked outside the lock and may dirty or destroy other properties
+            if (next.property)
+            {
+                try
+                {
+                    next.commit(next.property);
+                }
+                catch (...)
+                {
+                    settle();
+                    throw;
+                }
+            }
+        }
+    }
+};
+
+//------------------------------------------------------------------------------
+
+/// <summary>
+/// Latest value holder notifying its signal once per commit instead of once per write.
+/// Writes equal to the current value are suppressed, other writes only mark the property dirty.
+/// A property written back to its last committed value is clean again and notifies nothing.
+/// </summary>
+/// <typeparam name="T">The value type which must be copyable and equality comparable</typeparam>
+/// <typeparam name="MT_Policy">The threading policy of the property, its batch, and its signal</typeparam>
+template <typename T, typename MT_Policy = ST_Policy>
+class Property final : private MT_Policy
+{
+    using signal_type = Signal<void(T const&), MT_Policy>;
+    using batch_type = Property_Batch<MT_Policy>;
+
+    T value {};
+    // The value last notified, against which dirtiness is tracked
+    T committed {};
+    bool dirty = false;
+    // Whether the batch holds an entry for this property
+    bool queued = false;
+
+    batch_type* batch = nullptr;
+    signal_type changed;
+
+    //--------------------------------------------------------------------------
+
+    static void batched_commit(void* property)
+    {
+        auto self = static_cast<Property*>(property);
+        {
+            [[maybe_unused]]
+            auto lock = self->MT_Policy::lock_guard();
+
+            self->queued = false;
+        }
+        self->commit();
+    }
+
+    bool is_queued() const
+    {
+        [[maybe_unused]]
+        auto lock = MT_Policy::lock_guard();
+
+        return queued;
+    }
+
+    public:
+
+    Property() = default;
+
+    explicit Property(T initial) : value(std::move(initial)), committed(value) {}
+
+    Property(T initial, batch_type& batched) : value(std::move(initial)), committed(value), batch(&batched) {}
+
+    ~Property() noexcept
+    {
+        if (batch)
+        {
+            batch->dequeue(this, is_queued());
+        }
+    }
+
+    Property(Property const&) = delete;
+    Property& operator= (Property const&) = delete;
+
+    Property(Property&&) = delete;
+    Property& operator= (Property&&) = delete;
+
+    /// <summary>
+    /// The signal notified upon commit, for use of the full Nano::Signal API
+    /// </summary>
+    signal_type& signal() noexcept
+    {
+        return changed;
+    }
+
+    T get() const
+    {
+        [[maybe_unused]]
+        auto lock = MT_Policy::lock_guard();
+
+        return value;
+    }
+
+    bool is_dirty() const
+    {
+        [[maybe_unused]]
+        auto lock = MT_Policy::lock_guard();
+
+        return dirty;
+    }
+
+    //-------------------------------------------------------CONNECT / DISCONNECT
+
+    template <auto mem_ptr, typename L>
+    void connect(L& instance)
+    {
+        changed.template connect<mem_ptr>(instance);
+    }
+
+    template <auto mem_ptr, typename L>
+    void disconnect(L& instance)
+    {
+        changed.template disconnect<mem_ptr>(instance);
+    }
+
+    //-----------------------------------------------------------------SET / COMMIT
+
+    // Returns false if the write was suppressed as unchanged
+    template <typename U>
+    bool set(U&& next)
+    {
+        bool enqueue = false;
+        {
+            [[maybe_unused]]
+            auto lock = MT_Policy::lock_guard();
+
+            if (value == next)
+            {
+                return false;
+            }
+            value = std::forward<U>(next);
+            dirty = !(value == committed);
+
+            enqueue = dirty && batch && !queued;
+            queued = queued || enqueue;
+        }
+        if (enqueue)
+        {
+            batch->enqueue(this, &batched_commit);
+        }
+        return true;
+    }
+
+    // Returns false if there was nothing to notify
+    bool commit()
+    {
+        std::optional<T> notified;
+        {
+            [[maybe_unused]]
+            auto lock = MT_Policy::lock_guard();
+
+            if (!dirty)
+            {
+                return false;
+            }
+            dirty = false;
+            committed = value;
+            notified.emplace(value);
+        }
+        // A copy so that slots may write to the property while being notified
+        changed.fire(*notified);
+        return true;
+    }
+};
+
+} // namespace Nano ------------------------------------------------------------
@@ -1,5 +1,23 @@
 #pragma once
 
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <optional>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+// Signals can be awaited by C++20 coroutines, see Signal::next.
+// Only the awaiter depends on it so that signals have the same layout under every standard.
+#if defined(__cpp_impl_coroutine) && defined(__has_include)
+#if __has_include(<coroutine>)
+#include <coroutine>
+#define NANO_COROUTINES
+#endif
+#endif
+
+#include "nano_combine.hpp"
 #include "nano_function.hpp"
 #include "nano_observer.hpp"
 
@@ -14,11 +32,14 @@ class Signal<RT(Args...), MT_Policy> final : public Observer<MT_Policy>
     using observer = Observer<MT_Policy>;
     using function = Function<RT(Args...)>;
 
+    // Forwarding from Function is the only access required
+    friend function;
+
     template <typename T>
     void insert_sfinae(Delegate_Key const& key, typename T::Observer* instance)
     {
-        observer::insert(key, instance);
-        instance->insert(key, this);
+        join_group();
+        observer::insert_linked(key, instance);
     }
     template <typename T>
     void remove_sfinae(Delegate_Key const& key, typename T::Observer* instance)
@@ -29,7 +50,7 @@ class Signal<RT(Args...), MT_Policy> final : public Observer<MT_Policy>
     template <typename T>
     void insert_sfinae(Delegate_Key const& key, ...)
     {
-        observer::insert(key, this);
+        grouped_insert(key, this);
     }
     template <typename T>
     void remove_sfinae(Delegate_Key const& key, ...)
@@ -37,23 +58,386 @@ class Signal<RT(Args...), MT_Policy> final : public Observer<MT_Policy>
         observer::remove(key);
     }
 
+    //--------------------------------------------------------------------------
+
+    // Safe policies emit from a copy of the connections which may outlive a disconnect
+    static constexpr bool emits_copy = !std::is_reference_v<decltype(
+        std::declval<MT_Policy const&>().copy_or_ref(std::declval<int const&>(), false))>;
+
+    // Of which the thread safe policies invoke the copy after releasing the lock
+    static constexpr bool emits_unlocked = emits_copy &&
+        !std::is_same_v<decltype(std::declval<MT_Policy const&>().lock_guard()), bool>;
+
+    class Emission final
+    {
+        std::atomic_size_t* const count;
+
+        public:
+
+        Emission(std::atomic_size_t* counter) noexcept : count(counter)
+        {
+            if (count)
+            {
+                count->fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+        ~Emission()
+        {
+            if (count)
+            {
+                count->fetch_sub(1, std::memory_order_release);
+            }
+        }
+
+        Emission(Emission const&) = delete;
+        Emission& operator= (Emission const&) = delete;
+    };
+
+    Function_Pool owned;
+    std::atomic_bool owning = { false };
+    std::atomic_size_t emitting = { 0 };
+    std::atomic_size_t blocked = { 0 };
+
+    /// <summary>
+    /// Stands in for this signal at the receiving end of each forward_to.
+    /// Being an observer of its own it is never emitted, yet disconnects the forwards upon destruction.
+    /// </summary>
+    struct Relay final : observer
+    {
+        Signal* target;
+
+        explicit Relay(Signal* signal) noexcept : target(signal) {}
+    };
+
+    std::unique_ptr<Relay> relay;
+
+    // The groups this signal has joined, so that they can forget it when it goes away
+    std::vector<Group*> groups;
+
+    /// <summary>
+    /// Intrusive list node of a suspended coroutine, lives within the awaiter in the coroutine frame.
+    /// The arguments are delivered as the signature declares them, references stay references.
+    /// </summary>
+    struct Waiter
+    {
+        std::atomic<Signal*> signal = { nullptr };
+        // The head of the list holding the waiter, either the signal or a batch being resumed
+        Waiter** list = nullptr;
+        Waiter* prev = nullptr;
+        Waiter* next = nullptr;
+        // The address of the coroutine frame and how to resume it
+        void* frame = nullptr;
+        void (*resume)(void*) = nullptr;
+        std::optional<std::tuple<Args...>> values;
+    };
+
+    Waiter* waiters = nullptr;
+    std::atomic_bool waiting = { false };
+
+    void nolock_link(Waiter* waiter) noexcept
+    {
+        waiter->signal = this;
+        waiter->list = &waiters;
+        waiter->prev = nullptr;
+        waiter->next = std::exchange(waiters, waiter);
+
+        if (waiter->next)
+        {
+            waiter->next->prev = waiter;
+        }
+        waiting.store(true, std::memory_order_release);
+    }
+
+    void nolock_unlink(Waiter* waiter) noexcept
+    {
+        (waiter->prev ? waiter->prev->next : *waiter->list) = waiter->next;
+
+        if (waiter->next)
+        {
+            waiter->next->prev = waiter->prev;
+        }
+        waiter->signal = nullptr;
+        waiting.store(waiters != nullptr, std::memory_order_release);
+    }
+
+    // Detaches every waiter so that none of them refers back to this signal
+    Waiter* nolock_detach_waiters() noexcept
+    {
+        for (auto waiter = waiters; waiter; waiter = waiter->next)
+        {
+            waiter->signal = nullptr;
+        }
+        waiting.store(false, std::memory_order_release);
+        return std::exchange(waiters, nullptr);
+    }
+
+    // Coroutines awaiting again from within their resumption wait for the following emission
+    template <typename... Uref>
+    void resume_waiters(Uref&... args)
+    {
+        if (!waiting.load(std::memory_order_acquire))
+        {
+            return;
+        }
+        // The batch remains a list of its own so that waiters destroyed meanwhile can still leave it
+        Waiter* batch = nullptr;
+        {
+            [[maybe_unused]]
+            auto lock = observer::lock_guard();
+
+            batch = std::exchange(waiters, nullptr);
+
+            for (auto waiter = batch; waiter; waiter = waiter->next)
+            {
+                waiter->list = &batch;
+            }
+            waiting.store(false, std::memory_order_release);
+        }
+        for (;;)
+        {
+            Waiter* waiter = nullptr;
+            {
+                [[maybe_unused]]
+                auto lock = observer::lock_guard();
+
+                // Each waiter is unlinked under the lock before it is resumed
+                if (!(waiter = batch))
+                {
+                    return;
+                }
+                if ((batch = waiter->next))
+                {
+                    batch->prev = nullptr;
+                }
+                waiter->signal = nullptr;
+            }
+            waiter->values.emplace(function::peek(args)...);
+            waiter->resume(waiter->frame);
+        }
+    }
+
+    inline Emission emission() noexcept
+    {
+        // Owned function objects may only be destroyed once no emission can reach them.
+        // Unlocked copies are always counted as another thread may connect one while copying.
+        return Emission(emits_unlocked || owning.load(std::memory_order_acquire) ? &emitting : nullptr);
+    }
+
+    void take_waiters(Signal& other) noexcept
+    {
+        [[maybe_unused]]
+        auto lock = observer::lock_guard();
+
+        nolock_detach_waiters();
+
+        for (auto waiter = other.nolock_detach_waiters(); waiter; )
+        {
+            nolock_link(std::exchange(waiter, waiter->next));
+        }
+    }
+
+    static void group_disconnect(void* self, Group* group) noexcept
+    {
+        auto signal = static_cast<Signal*>(self);
+        signal->disconnect_group(group->tag());
+
+        [[maybe_unused]]
+        auto lock = signal->observer::lock_guard();
+
+        auto& joined = signal->groups;
+        joined.erase(std::remove(std::begin(joined), std::end(joined), group), std::end(joined));
+    }
+
+    // Joining before connecting means a failed connect leaves nothing to disconnect behind
+    void join_group()
+    {
+        auto group = Group_Scope::current;
+
+        if (!group)
+        {
+            return;
+        }
+        {
+            [[maybe_unused]]
+            auto lock = observer::lock_guard();
+
+            if (std::find(std::begin(groups), std::end(groups), group) != std::end(groups))
+            {
+                return;
+            }
+            groups.push_back(group);
+        }
+        group->join(this, &Signal::group_disconnect);
+    }
+
+    void grouped_insert(Delegate_Key const& key, observer* obs)
+    {
+        join_group();
+        observer::insert(key, obs);
+    }
+
+    // Rejoins the groups of other in its place, or leaves them when given nullptr
+    void take_groups(Signal* other) noexcept
+    {
+        std::vector<Group*> joined;
+        {
+            [[maybe_unused]]
+            auto lock = observer::lock_guard();
+
+            joined.swap(groups);
+        }
+        for (auto group : joined)
+        {
+            group->replace(this, nullptr);
+        }
+        joined.clear();
+
+        if (!other)
+        {
+            return;
+        }
+        {
+            [[maybe_unused]]
+            auto lock = other->observer::lock_guard();
+
+            joined.swap(other->groups);
+        }
+        for (auto group : joined)
+        {
+            group->replace(other, this);
+        }
+
+        [[maybe_unused]]
+        auto lock = observer::lock_guard();
+
+        groups = std::move(joined);
+    }
+
+    Relay* receiving_relay()
+    {
+        [[maybe_unused]]
+        auto lock = observer::lock_guard();
+
+        if (!relay)
+        {
+            relay = std::make_unique<Relay>(this);
+        }
+        return relay.get();
+    }
+
+    Relay* existing_relay() const
+    {
+        [[maybe_unused]]
+        auto lock = observer::lock_guard();
+
+        return relay.get();
+    }
+
+    // Emission forwarded from another signal, the arguments arrive already adapted
+    template <typename... Params>
+    void forwarded(Params&&... args)
+    {
+        if (is_blocked())
+        {
+            return;
+        }
+        resume_waiters(args...);
+
+        [[maybe_unused]]
+        auto scope = emission();
+
+        observer::template for_each<function>(std::forward<Params>(args)...);
+    }
+
+    inline void nolock_collect() noexcept
+    {
+        if (emitting.load(std::memory_order_acquire) == 0)
+        {
+            owned.collect();
+        }
+        observer::owned_probe(owned.footprint_bytes());
+    }
+
     public:
 
     Signal() noexcept = default;
-    ~Signal() noexcept = default;
+    ~Signal() noexcept
+    {
+        // Groups must forget this signal before any of it is torn down
+        take_groups(nullptr);
+
+        // Forwards into this signal must end while all of it is still alive
+        relay.reset();
+
+        {
+            [[maybe_unused]]
+            auto lock = observer::lock_guard();
+
+            // Coroutines still waiting are never resumed, their owners remain responsible for them
+            nolock_detach_waiters();
+        }
+
+        // Owned function objects must outlive every emission still in flight
+        if (owning.load(std::memory_order_relaxed))
+        {
+            observer::before_disconnect_all();
+            observer::disconnect_all();
+        }
+    }
+
+    // Only available when using an instrumented policy such as Nano::Instrumented
+    explicit Signal(const char* name) noexcept
+    {
+        observer::name(name);
+    }
 
     Signal(Signal const&) noexcept = delete;
     Signal& operator= (Signal const&) noexcept = delete;
 
-    Signal(Signal&&) noexcept = default;
-    Signal& operator=(Signal&&) noexcept = default;
+    Signal(Signal&& other) noexcept :
+        observer(std::move(other)),
+        owned(std::move(other.owned)),
+        owning(other.owning.load(std::memory_order_relaxed)),
+        blocked(other.blocked.load(std::memory_order_relaxed)),
+        relay(std::move(other.relay))
+    {
+        if (relay)
+        {
+            relay->target = this;
+        }
+        take_groups(&other);
+        take_waiters(other);
+
+        observer::owned_probe(owned.footprint_bytes());
+        other.observer::owned_probe(other.owned.footprint_bytes());
+    }
+
+    Signal& operator=(Signal&& other) noexcept
+    {
+        observer::operator=(std::move(other));
+        owned = std::move(other.owned);
+        owning.store(other.owning.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        blocked.store(other.blocked.load(std::memory_order_relaxed), std::memory_order_relaxed);
+
+        if ((relay = std::move(other.relay)))
+        {
+            relay->target = this;
+        }
+        take_groups(&other);
+        take_waiters(other);
+
+        observer::owned_probe(owned.footprint_bytes());
+        other.observer::owned_probe(other.owned.footprint_bytes());
+
+        return *this;
+    }
 
     //-------------------------------------------------------------------CONNECT
 
     template <typename L>
     void connect(L* instance)
     {
-        observer::insert(function::template bind(instance), this);
+        grouped_insert(function::template bind(instance), this);
     }
     template <typename L>
     void connect(L& instance)
@@ -61,10 +445,49 @@ class Signal<RT(Args...), MT_Policy> final : public Observer<MT_Policy>
         connect(std::addressof(instance));
     }
 
+    // The signal takes ownership of function objects passed as rvalues
+    template <typename L, typename = std::enable_if_t<!std::is_reference_v<L> && !std::is_pointer_v<L>>>
+    Delegate_Key connect(L&& functor)
+    {
+        join_group();
+
+        [[maybe_unused]]
+        auto lock = observer::lock_guard();
+
+        owning.store(true, std::memory_order_relaxed);
+        nolock_collect();
+
+        auto [object, handle] = owned.construct(std::move(functor));
+
+        Delegate_Key key = function::template bind(object);
+        key[2] = handle;
+
+        try
+        {
+            observer::nolock_insert(key, this);
+        }
+        catch (...)
+        {
+            owned.retire(key);
+            owned.collect();
+            throw;
+        }
+        observer::owned_probe(owned.footprint_bytes());
+
+        return key;
+    }
+
     template <RT(*fun_ptr)(Args...)>
     void connect()
     {
-        observer::insert(function::template bind<fun_ptr>(), this);
+        grouped_insert(function::template bind<fun_ptr>(), this);
+    }
+
+    // Free functions taking a prefix of the arguments, convertible arguments or returning another type
+    template <auto fun_ptr, typename = std::enable_if_t<!std::is_same_v<decltype(fun_ptr), RT(*)(Args...)>>>
+    void connect()
+    {
+        grouped_insert(function::template bind<fun_ptr>(), this);
     }
 
     template <typename T, RT(T::*mem_ptr)(Args...)>
@@ -100,6 +523,33 @@ class Signal<RT(Args...), MT_Policy> final : public Observer<MT_Policy>
         connect<mem_ptr, T>(std::addressof(instance));
     }
 
+    // The context is stored within the connection and passed as the leading argument of the slot
+    template <auto mem_ptr, typename T, typename C>
+    void connect(T* instance, C const& context)
+    {
+        insert_sfinae<T>(function::template bind<mem_ptr>(instance, context), instance);
+    }
+    template <auto mem_ptr, typename T, typename C>
+    void connect(T& instance, C const& context)
+    {
+        connect<mem_ptr, T, C>(std::addressof(instance), context);
+    }
+
+    /// <summary>
+    /// Emissions of this signal continue directly into the slots of the target signal.
+    /// Either signal being destroyed disconnects the forward.
+    /// </summary>
+    void forward_to(Signal& target)
+    {
+        static_assert(std::is_void_v<RT>, "Only signals returning void can forward");
+
+        auto receiver = target.receiving_relay();
+        auto key = function::template bind_forward(receiver);
+
+        join_group();
+        observer::insert_linked(key, receiver);
+    }
+
     //----------------------------------------------------------------DISCONNECT
 
     template <typename L>
@@ -107,18 +557,62 @@ class Signal<RT(Args...), MT_Policy> final : public Observer<MT_Policy>
     {
         observer::remove(function::template bind(instance));
     }
-    template <typename L>
+    template <typename L, typename = std::enable_if_t<!std::is_same_v<std::remove_const_t<L>, Delegate_Key>>>
     void disconnect(L& instance)
     {
         disconnect(std::addressof(instance));
     }
 
+    // Disconnect by key, such as those returned when connecting an owned function object
+    void disconnect(Delegate_Key const& key)
+    {
+        [[maybe_unused]]
+        auto lock = observer::lock_guard();
+
+        observer::nolock_disconnect(key);
+
+        if (owned.retire(key))
+        {
+            nolock_collect();
+        }
+    }
+
+    void disconnect_all()
+    {
+        [[maybe_unused]]
+        auto lock = observer::lock_guard();
+
+        observer::nolock_disconnect_all();
+
+        owned.retire_all();
+        nolock_collect();
+    }
+
+    // Disconnects the slots connected within the scopes of the group with this tag
+    void disconnect_group(Group_Tag tag) noexcept
+    {
+        [[maybe_unused]]
+        auto lock = observer::lock_guard();
+
+        observer::nolock_disconnect_group(tag, [this](auto const& slot)
+        {
+            owned.retire(slot.delegate);
+        });
+        nolock_collect();
+    }
+
     template <RT(*fun_ptr)(Args...)>
     void disconnect()
     {
         observer::remove(function::template bind<fun_ptr>());
     }
 
+    template <auto fun_ptr, typename = std::enable_if_t<!std::is_same_v<decltype(fun_ptr), RT(*)(Args...)>>>
+    void disconnect()
+    {
+        observer::remove(function::template bind<fun_ptr>());
+    }
+
     template <typename T, RT(T::*mem_ptr)(Args...)>
     void disconnect(T* instance)
     {
@@ -152,20 +646,253 @@ class Signal<RT(Args...), MT_Policy> final : public Observer<MT_Policy>
         disconnect<mem_ptr, T>(std::addressof(instance));
     }
 
+    template <auto mem_ptr, typename T, typename C>
+    void disconnect(T* instance, C const& context)
+    {
+        remove_sfinae<T>(function::template bind<mem_ptr>(instance, context), instance);
+    }
+    template <auto mem_ptr, typename T, typename C>
+    void disconnect(T& instance, C const& context)
+    {
+        disconnect<mem_ptr, T, C>(std::addressof(instance), context);
+    }
+
+    void disconnect_forward(Signal& target)
+    {
+        static_assert(std::is_void_v<RT>, "Only signals returning void can forward");
+
+        // A target without a relay has never been forwarded to
+        auto receiver = target.existing_relay();
+        if (!receiver)
+        {
+            return;
+        }
+        auto key = function::template bind_forward(receiver);
+
+        observer::remove(key);
+        receiver->remove(key);
+    }
+
+    //------------------------------------------------------------BLOCK / MUTE
+
+    /// <summary>
+    /// Releases its block on the signal when going out of scope
+    /// </summary>
+    class Blocker final
+    {
+        Signal& signal;
+
+        public:
+
+        explicit Blocker(Signal& blocked) noexcept : signal(blocked)
+        {
+            signal.block();
+        }
+        ~Blocker()
+        {
+            signal.unblock();
+        }
+
+        Blocker(Blocker const&) = delete;
+        Blocker& operator= (Blocker const&) = delete;
+    };
+
+    // Blocks nest, the signal fires again once every block has been released
+    void block() noexcept
+    {
+        blocked.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void unblock() noexcept
+    {
+        blocked.fetch_sub(1, std::memory_order_relaxed);
+    }
+
+    bool is_blocked() const noexcept
+    {
+        return blocked.load(std::memory_order_relaxed) != 0;
+    }
+
+    [[nodiscard]] Blocker blocker() noexcept
+    {
+        return Blocker(*this);
+    }
+
+    /// <summary>
+    /// Mutes every connection of the key with a single store, obtain it once when toggling often
+    /// </summary>
+    Mute_Handle mute_handle(Delegate_Key const& key)
+    {
+        return observer::mute_handle(key);
+    }
+
+    // Muted slots stay connected but emissions skip them until unmuted
+    void mute(Delegate_Key const& key)
+    {
+        observer::mute_handle(key).mute();
+    }
+
+    void unmute(Delegate_Key const& key)
+    {
+        observer::mute_handle(key).unmute();
+    }
+
+#ifdef NANO_COROUTINES
+
+    //------------------------------------------------------------------AWAITING
+
+    /// <summary>
+    /// Awaiter resuming the coroutine upon the next emission, before any slot is invoked.
+    /// Nothing is allocated, the awaiter is linked into the signal from within the coroutine frame.
+    /// </summary>
+    class Next final
+    {
+        Signal& signal;
+        Waiter waiter;
+
+        public:
+
+        explicit Next(Signal& awaited) noexcept : signal(awaited) {}
+        ~Next()
+        {
+            // A coroutine destroyed while waiting must leave the list
+            if (auto linked = waiter.signal.load())
+            {
+                [[maybe_unused]]
+                auto lock = linked->observer::lock_guard();
+
+                if (waiter.signal.load())
+                {
+                    linked->nolock_unlink(&waiter);
+                }
+            }
+        }
+
+        Next(Next const&) = delete;
+        Next& operator= (Next const&) = delete;
+
+        constexpr bool await_ready() const noexcept
+        {
+            return false;
+        }
+
+        void await_suspend(std::coroutine_handle<> handle) noexcept
+        {
+            [[maybe_unused]]
+            auto lock = signal.observer::lock_guard();
+
+            waiter.frame = handle.address();
+            waiter.resume = [](void* frame)
+            {
+                std::coroutine_handle<>::from_address(frame).resume();
+            };
+            signal.nolock_link(&waiter);
+        }
+
+        // Void, the only argument, or a tuple of every argument
+        using Result = std::conditional_t<(sizeof...(Args) > 1),
+            std::tuple<Args...>, std::tuple_element_t<0, std::tuple<Args..., void>>>;
+
+        Result await_resume()
+        {
+            if constexpr (sizeof...(Args) == 1)
+            {
+                return std::get<0>(std::move(*waiter.values));
+            }
+            else if constexpr (sizeof...(Args) > 1)
+            {
+                return std::move(*waiter.values);
+            }
+        }
+    };
+
+    [[nodiscard]] Next next() noexcept
+    {
+        return Next(*this);
+    }
+
+#endif
+
     //----------------------------------------------------FIRE / FIRE ACCUMULATE
 
     template <typename... Uref>
     void fire(Uref&&... args)
     {
+        if (is_blocked())
+        {
+            return;
+        }
+        resume_waiters(args...);
+
+        [[maybe_unused]]
+        auto scope = emission();
+
         observer::template for_each<function>(std::forward<Uref>(args)...);
     }
 
+    // Lvalue arguments are treated as expiring so the final slot may move from them
+    template <typename... Uref>
+    void fire_move(Uref&&... args)
+    {
+        if (is_blocked())
+        {
+            return;
+        }
+        resume_waiters(args...);
+
+        [[maybe_unused]]
+        auto scope = emission();
+
+        observer::template for_each<function>(std::move(args)...);
+    }
+
+    // Returns the key of the slot whose SRV made the accumulator return Nano::Flow::Stop
     template <typename Accumulate, typename... Uref>
-    void fire_accumulate(Accumulate&& accumulate, Uref&&... args)
+    std::optional<Delegate_Key> fire_accumulate(Accumulate&& accumulate, Uref&&... args)
     {
-        observer::template for_each_accumulate<function, Accumulate>
+        if (is_blocked())
+        {
+            return std::nullopt;
+        }
+        resume_waiters(args...);
+
+        [[maybe_unused]]
+        auto scope = emission();
+
+        return observer::template for_each_accumulate<function, Accumulate>
             (std::forward<Accumulate>(accumulate), std::forward<Uref>(args)...);
     }
+
+    // Fire using a Nano::Combine combiner and return its result
+    template <template <typename> typename Combiner, typename... Uref>
+    auto fire_accumulate(Uref&&... args)
+    {
+        Combiner<RT> combiner;
+        fire_accumulate(combiner, std::forward<Uref>(args)...);
+        return combiner.result();
+    }
+
+    //---------------------------------------------------FIRE UNTIL / FIRE WHILE
+
+    template <typename Predicate, typename... Uref>
+    std::optional<Delegate_Key> fire_until(Predicate&& predicate, Uref&&... args)
+    {
+        return fire_accumulate([&predicate](auto&& srv)
+        {
+            return predicate(std::forward<decltype(srv)>(srv)) ? Flow::Stop : Flow::Continue;
+        },
+        std::forward<Uref>(args)...);
+    }
+
+    template <typename Predicate, typename... Uref>
+    std::optional<Delegate_Key> fire_while(Predicate&& predicate, Uref&&... args)
+    {
+        return fire_accumulate([&predicate](auto&& srv)
+        {
+            return predicate(std::forward<decltype(srv)>(srv)) ? Flow::Continue : Flow::Stop;
+        },
+        std::forward<Uref>(args)...);
+    }
 };
 
 } // namespace Nano ------------------------------------------------------------
@@ -0,0 +1,221 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "nano_combine.hpp"
+
+namespace Nano
+{
+
+/// <summary>
+/// Signal whose slots are fixed at compile time.
+/// Emission expands into direct calls which the compiler is free to inline,
+/// there is no connection list, no lock and no thunk indirection.
+/// Member function slots are bound to their instances upon construction, in order.
+/// </summary>
+template <typename RT, auto... slots>
+class Static_Signal;
+template <typename RT, typename... Args, auto... slots>
+class Static_Signal<RT(Args...), slots...> final
+{
+    struct Unbound {};
+
+    template <typename Slot>
+    struct Binding
+    {
+        using type = Unbound;
+        static constexpr bool member = false;
+    };
+    template <typename T, typename R, typename... A>
+    struct Binding<R(T::*)(A...)>
+    {
+        using type = T*;
+        static constexpr bool member = true;
+    };
+    template <typename T, typename R, typename... A>
+    struct Binding<R(T::*)(A...) const>
+    {
+        using type = T const*;
+        static constexpr bool member = true;
+    };
+    template <typename T, typename R, typename... A>
+    struct Binding<R(T::*)(A...) noexcept>
+    {
+        using type = T*;
+        static constexpr bool member = true;
+    };
+    template <typename T, typename R, typename... A>
+    struct Binding<R(T::*)(A...) const noexcept>
+    {
+        using type = T const*;
+        static constexpr bool member = true;
+    };
+
+    using Instances = std::tuple<typename Binding<decltype(slots)>::type...>;
+    using Indices = std::make_index_sequence<sizeof...(slots)>;
+
+    static constexpr std::array<bool, sizeof...(slots)> members = { Binding<decltype(slots)>::member... };
+    static constexpr std::size_t last = sizeof...(slots) - 1;
+
+    Instances instances;
+
+    //--------------------------------------------------------------------------
+
+    // Position of a member slot's instance within the constructor arguments
+    template <std::size_t I>
+    static constexpr std::size_t bound_index()
+    {
+        std::size_t index = 0;
+        for (std::size_t i = 0; i < I; ++i)
+        {
+            index += members[i];
+        }
+        return index;
+    }
+
+    template <std::size_t I, typename Bound>
+    static auto bind(Bound const& bound) -> std::tuple_element_t<I, Instances>
+    {
+        if constexpr (members[I])
+        {
+            return std::addressof(std::get<bound_index<I>()>(bound));
+        }
+        else
+        {
+            return {};
+        }
+    }
+
+    template <std::size_t... I, typename Bound>
+    Static_Signal(std::index_sequence<I...>, Bound const& bound) : instances(bind<I>(bound)...)
+    {
+
+    }
+
+    //--------------------------------------------------------------------------
+
+    template <std::size_t I, typename... Uref>
+    RT invoke_one(Uref&&... args) const
+    {
+        constexpr auto slot = std::get<I>(std::make_tuple(slots...));
+
+        // Only the final slot may consume the arguments
+        if constexpr (I == last)
+        {
+            if constexpr (members[I])
+            {
+                return static_cast<RT>((std::get<I>(instances)->*slot)(std::forward<Uref>(args)...));
+            }
+            else
+            {
+                return static_cast<RT>((*slot)(std::forward<Uref>(args)...));
+            }
+        }
+        else
+        {
+            if constexpr (members[I])
+            {
+                return static_cast<RT>((std::get<I>(instances)->*slot)(args...));
+            }
+            else
+            {
+                return static_cast<RT>((*slot)(args...));
+            }
+        }
+    }
+
+    template <std::size_t... I, typename... Uref>
+    void for_each(std::index_sequence<I...>, Uref&&... args) const
+    {
+        (invoke_one<I>(std::forward<Uref>(args)...), ...);
+    }
+
+    template <std::size_t I, typename Accumulate, typename... Uref>
+    bool accumulate_one(Accumulate& accumulate, std::optional<std::size_t>& stopped, Uref&&... args) const
+    {
+        // Accumulators returning Nano::Flow decide whether the emission continues
+        if constexpr (std::is_same_v<decltype(accumulate(invoke_one<I>(std::forward<Uref>(args)...))), Flow>)
+        {
+            if (accumulate(invoke_one<I>(std::forward<Uref>(args)...)) == Flow::Stop)
+            {
+                stopped = I;
+                return false;
+            }
+        }
+        else
+        {
+            accumulate(invoke_one<I>(std::forward<Uref>(args)...));
+        }
+        return true;
+    }
+
+    template <std::size_t... I, typename Accumulate, typename... Uref>
+    std::optional<std::size_t> for_each_accumulate(std::index_sequence<I...>, Accumulate& accumulate, Uref&&... args) const
+    {
+        std::optional<std::size_t> stopped;
+        (accumulate_one<I>(accumulate, stopped, std::forward<Uref>(args)...) && ...);
+        return stopped;
+    }
+
+    public:
+
+    template <typename... T, typename = std::enable_if_t<!(std::is_same_v<std::decay_t<T>, Static_Signal> || ...)>>
+    explicit Static_Signal(T&... bound) noexcept : Static_Signal(Indices(), std::tie(bound...))
+    {
+        static_assert(sizeof...(T) == bound_index<sizeof...(slots)>(), "Bind one instance per member function slot");
+    }
+
+    //-------------------------------------------------------------------FIRING
+
+    template <typename... Uref>
+    void fire(Uref&&... args) const
+    {
+        for_each(Indices(), std::forward<Uref>(args)...);
+    }
+
+    // Returns the index of the slot whose SRV made the accumulator return Nano::Flow::Stop
+    template <typename Accumulate, typename... Uref>
+    std::optional<std::size_t> fire_accumulate(Accumulate&& accumulate, Uref&&... args) const
+    {
+        return for_each_accumulate(Indices(), accumulate, std::forward<Uref>(args)...);
+    }
+
+    // Fire using a Nano::Combine combiner and return its result
+    template <template <typename> typename Combiner, typename... Uref>
+    auto fire_accumulate(Uref&&... args) const
+    {
+        Combiner<RT> combiner;
+        fire_accumulate(combiner, std::forward<Uref>(args)...);
+        return combiner.result();
+    }
+
+    //---------------------------------------------------FIRE UNTIL / FIRE WHILE
+
+    template <typename Predicate, typename... Uref>
+    std::optional<std::size_t> fire_until(Predicate&& predicate, Uref&&... args) const
+    {
+        return fire_accumulate([&predicate](auto&& srv)
+        {
+            return predicate(std::forward<decltype(srv)>(srv)) ? Flow::Stop : Flow::Continue;
+        },
+        std::forward<Uref>(args)...);
+    }
+
+    template <typename Predicate, typename... Uref>
+    std::optional<std::size_t> fire_while(Predicate&& predicate, Uref&&... args) const
+    {
+        return fire_accumulate([&predicate](auto&& srv)
+        {
+            return predicate(std::forward<decltype(srv)>(srv)) ? Flow::Continue : Flow::Stop;
+        },
+        std::forward<Uref>(args)...);
+    }
+};
+
+} // namespace Nano ------------------------------------------------------------
@@ -0,0 +1,191 @@
+#include <cstddef>
+#include <cstdlib>
+#include <list>
+#include <new>
+
+#include "CppUnitTest.h"
+
+#include "Test_Base.hpp"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace
+{
+    thread_local std::size_t allocations = 0;
+}
+
+// Every other form of allocation defaults to these replacements.
+// The nothrow forms are replaced as well since sanitizers intercept them separately.
+
+void* operator new(std::size_t size)
+{
+    ++allocations;
+
+    if (auto memory = std::malloc(size ? size : 1))
+    {
+        return memory;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new(std::size_t size, std::nothrow_t const&) noexcept
+{
+    ++allocations;
+
+    return std::malloc(size ? size : 1);
+}
+
+void operator delete(void* memory) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete(void* memory, std::size_t) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete(void* memory, std::nothrow_t const&) noexcept
+{
+    std::free(memory);
+}
+
+namespace Nano_Tests
+{
+    TEST_CLASS(Test_Allocation)
+    {
+        const std::size_t N = 64;
+
+        class Allocation_Count
+        {
+            const std::size_t start = allocations;
+
+            public:
+
+            std::size_t count() const
+            {
+                return allocations - start;
+            }
+        };
+
+        template <typename Policy>
+        std::size_t fire_allocations()
+        {
+            using Moo_T = Moo<Nano::Observer<Policy>>;
+
+            Nano::Signal<void(Rng&), Policy> subject;
+
+            std::list<Moo_T> moo(N);
+            auto moo_instance = std::begin(moo);
+
+            Rng rng;
+
+            std::size_t allocated = 0;
+
+            // The second burst of connections lands behind those already emitted
+            for (std::size_t burst = 0; burst < 2; ++burst)
+            {
+                for (std::size_t i = 0; i < N / 2; ++i, ++moo_instance)
+                {
+                    subject.template connect<&Moo_T::slot_next_random>(*moo_instance);
+                }
+
+                Allocation_Count fired;
+
+                for (std::size_t i = 0; i < N / 2; ++i)
+                {
+                    subject.fire(rng);
+                }
+                allocated += fired.count();
+            }
+            return allocated;
+        }
+
+        template <typename Policy>
+        std::size_t connect_allocations()
+        {
+            Nano::Signal<void(Rng&), Policy> subject;
+
+            Allocation_Count allocated;
+
+            for (std::size_t i = 0; i < N; ++i)
+            {
+                subject.template connect<&slot_next_random_free_function>();
+            }
+            return allocated.count();
+        }
+
+        public:
+
+        TEST_METHOD(Test_Fire_Allocations)
+        {
+            Assert::IsTrue(fire_allocations<Nano::ST_Policy>() == 0, L"ST_Policy fire allocated.");
+            Assert::IsTrue(fire_allocations<Nano::TS_Policy<>>() == 0, L"TS_Policy fire allocated.");
+
+            // The safe policies emit from a copy of the connections
+            Assert::IsTrue(fire_allocations<Nano::ST_Policy_Safe>() == N, L"ST_Policy_Safe fire did not allocate once.");
+            Assert::IsTrue(fire_allocations<Nano::TS_Policy_Safe<>>() == N, L"TS_Policy_Safe fire did not allocate once.");
+        }
+
+        TEST_METHOD(Test_Fire_Accumulate_Allocations)
+        {
+            Nano::Signal<int(int)> subject;
+
+            auto slot_one = [](int val) { return val; };
+            auto slot_two = [](int val) { return val * 2; };
+
+            subject.connect(slot_one);
+            subject.connect(slot_two);
+
+            int sum = 0;
+
+            Allocation_Count allocated;
+
+            for (std::size_t i = 0; i < N; ++i)
+            {
+                subject.fire_accumulate([&](int srv) { sum += srv; }, i);
+                subject.fire_accumulate<Nano::Combine::Sum>(i);
+            }
+            Assert::IsTrue(allocated.count() == 0, L"ST_Policy fire_accumulate allocated.");
+        }
+
+        TEST_METHOD(Test_Connect_Amortized)
+        {
+            // Geometric growth bounds N connections to a logarithmic number of allocations
+            std::size_t bound = 0;
+            for (std::size_t n = N; n; n >>= 1)
+            {
+                ++bound;
+            }
+            Assert::IsTrue(connect_allocations<Nano::ST_Policy>() <= bound, L"ST_Policy connect was not amortized.");
+            Assert::IsTrue(connect_allocations<Nano::TS_Policy<>>() <= bound, L"TS_Policy connect was not amortized.");
+            Assert::IsTrue(connect_allocations<Nano::ST_Policy_Safe>() <= bound, L"ST_Policy_Safe connect was not amortized.");
+            Assert::IsTrue(connect_allocations<Nano::TS_Policy_Safe<>>() <= bound, L"TS_Policy_Safe connect was not amortized.");
+        }
+
+        TEST_METHOD(Test_Observer_Construction)
+        {
+            {
+                Allocation_Count allocated;
+                Moo<Observer_TS> observer;
+                Assert::IsTrue(allocated.count() == 0, L"TS_Policy observer construction allocated.");
+            }
+            {
+                Allocation_Count allocated;
+                Moo<Observer_TSS> observer;
+                Assert::IsTrue(allocated.count() == 1, L"TS_Policy_Safe observer did not allocate its tracker once.");
+            }
+        }
+
+        TEST_METHOD(Test_Disconnect_Unforwarded)
+        {
+            Nano::Signal<void(Rng&)> signal_one;
+            Nano::Signal<void(Rng&)> signal_two;
+
+            Allocation_Count allocated;
+
+            signal_one.disconnect_forward(signal_two);
+            Assert::IsTrue(allocated.count() == 0, L"Disconnecting a missing forward allocated.");
+        }
+    };
+}
@@ -161,4 +161,24 @@ namespace Nano_Tests
             return *this;
         }
     };
+
+    //--------------------------------------------------------------------------
+
+    class Move_Count
+    {
+        public:
+
+        std::size_t copies = 0;
+        std::size_t moves = 0;
+
+        Move_Count() = default;
+        Move_Count(Move_Count const& other) : copies(other.copies + 1), moves(other.moves)
+        {
+
+        }
+        Move_Count(Move_Count&& other) noexcept : copies(other.copies), moves(other.moves + 1)
+        {
+            other.copies = other.moves = 0;
+        }
+    };
 }
@@ -0,0 +1,172 @@
+#include <optional>
+#include <string>
+#include <tuple>
+#include <utility>
+
+#include "CppUnitTest.h"
+
+#include "Test_Base.hpp"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+// Awaiting signals requires C++20 coroutines
+#ifdef NANO_COROUTINES
+
+namespace Nano_Tests
+{
+    namespace
+    {
+        using Signal_Bool = Nano::Signal<bool(const char*)>;
+
+        // Owns its coroutine frame so that a test can destroy it while suspended
+        struct Task
+        {
+            struct promise_type
+            {
+                Task get_return_object()
+                {
+                    return Task(std::coroutine_handle<promise_type>::from_promise(*this));
+                }
+                std::suspend_never initial_suspend() noexcept { return {}; }
+                std::suspend_always final_suspend() noexcept { return {}; }
+                void return_void() {}
+                void unhandled_exception() {}
+            };
+
+            std::coroutine_handle<promise_type> handle;
+
+            explicit Task(std::coroutine_handle<promise_type> frame) noexcept : handle(frame) {}
+            Task(Task&& other) noexcept : handle(std::exchange(other.handle, nullptr)) {}
+
+            ~Task()
+            {
+                if (handle)
+                {
+                    handle.destroy();
+                }
+            }
+
+            bool done() const
+            {
+                return handle.done();
+            }
+        };
+
+        Task await_twice(Signal_Two& signal, std::string& received, std::size_t& lines)
+        {
+            auto [first, line] = co_await signal.next();
+            received = first;
+            lines += line;
+
+            auto second = co_await signal.next();
+            received += std::get<0>(second);
+            lines += std::get<1>(second);
+        }
+
+        Task await_then_destroy(Signal_One& signal, std::optional<Task>& other)
+        {
+            co_await signal.next();
+            other.reset();
+        }
+
+        Task await_accumulated(Signal_Bool& signal, std::string& received)
+        {
+            received = co_await signal.next();
+            received += co_await signal.next();
+        }
+
+        bool accept(const char*)
+        {
+            return true;
+        }
+
+        Task await_forever(Signal_One& signal, std::size_t& resumed)
+        {
+            for (;;)
+            {
+                co_await signal.next();
+                ++resumed;
+            }
+        }
+    }
+
+    TEST_CLASS(Test_Coroutine)
+    {
+        public:
+
+        TEST_METHOD(Test_Await_Next)
+        {
+            Signal_Two signal;
+
+            std::string received;
+            std::size_t lines = 0;
+
+            auto task = await_twice(signal, received, lines);
+
+            signal.fire("one", 1);
+            Assert::IsFalse(task.done(), L"A coroutine was not suspended again.");
+
+            signal.fire("two", 2);
+            Assert::IsTrue(task.done(), L"A coroutine was not resumed.");
+            Assert::IsTrue(received == "onetwo" && lines == 3, L"An argument was not delivered.");
+
+            signal.fire("three", 3);
+            Assert::IsTrue(received == "onetwo", L"A finished coroutine was resumed.");
+        }
+
+        TEST_METHOD(Test_Await_Accumulated)
+        {
+            Signal_Bool signal;
+            signal.connect<&accept>();
+
+            std::string received;
+            std::size_t accepted = 0;
+
+            auto task = await_accumulated(signal, received);
+
+            signal.fire_accumulate([&](bool srv) { accepted += srv; }, "one");
+            Assert::IsFalse(task.done(), L"A coroutine was not suspended again.");
+
+            signal.fire_until([](bool srv) { return !srv; }, "two");
+            Assert::IsTrue(task.done(), L"A coroutine was not resumed by fire_until.");
+            Assert::IsTrue(received == "onetwo" && accepted == 1, L"An argument was not delivered.");
+        }
+
+        TEST_METHOD(Test_Await_Destroyed)
+        {
+            Signal_One signal;
+
+            std::size_t resumed = 0;
+            {
+                auto first = await_forever(signal, resumed);
+                auto second = await_forever(signal, resumed);
+
+                signal.fire(__FUNCTION__);
+                Assert::IsTrue(resumed == 2, L"A waiting coroutine was not resumed.");
+            }
+            // Both coroutines left the waiter list when destroyed
+            signal.fire(__FUNCTION__);
+            Assert::IsTrue(resumed == 2, L"A destroyed coroutine was resumed.");
+        }
+
+        TEST_METHOD(Test_Await_Destroyed_By_Resumed)
+        {
+            Signal_One signal;
+
+            std::size_t resumed = 0;
+            std::optional<Task> second;
+
+            // Awaiters are resumed latest first, so the destroying coroutine awaits last
+            auto first = await_forever(signal, resumed);
+            second.emplace(await_forever(signal, resumed));
+            auto third = await_then_destroy(signal, second);
+
+            signal.fire(__FUNCTION__);
+
+            Assert::IsTrue(third.done() && !second, L"A coroutine was not destroyed.");
+            Assert::IsTrue(resumed == 1, L"A coroutine destroyed while waiting was resumed.");
+        }
+    };
+}
+
+#endif
@@ -0,0 +1,85 @@
+#include <string>
+
+#include "CppUnitTest.h"
+
+#include "Test_Base.hpp"
+#include "../nano_dispatcher.hpp"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace Nano_Tests
+{
+    namespace
+    {
+        struct Resized
+        {
+            int width = 0;
+            int height = 0;
+        };
+
+        struct Renamed
+        {
+            std::string name;
+        };
+
+        template <typename Observer_T>
+        struct Window : Observer_T
+        {
+            int area = 0;
+            std::string name;
+
+            void on_resized(Resized const& event)
+            {
+                area = event.width * event.height;
+            }
+            void on_renamed(Renamed const& event)
+            {
+                name = event.name;
+            }
+        };
+    }
+
+    TEST_CLASS(Test_Dispatcher)
+    {
+        public:
+
+        TEST_METHOD(Test_Publish)
+        {
+            Nano::Dispatcher<> dispatcher;
+            Window<Observer> window;
+
+            dispatcher.connect<&Window<Observer>::on_resized>(window);
+            dispatcher.connect<&Window<Observer>::on_renamed>(window);
+
+            dispatcher.publish(Resized { 4, 3 });
+            dispatcher.publish(Renamed { "nano" });
+            dispatcher.publish(42);
+
+            Assert::IsTrue(window.area == 12, L"An event was not routed to its slot.");
+            Assert::IsTrue(window.name == "nano", L"An event was not routed to its slot.");
+
+            dispatcher.disconnect<&Window<Observer>::on_resized>(window);
+            dispatcher.publish(Resized { 1, 1 });
+
+            Assert::IsTrue(window.area == 12, L"An event was routed to a disconnected slot.");
+            Assert::IsTrue(dispatcher.signal<Resized>().is_empty(), L"A slot was found.");
+        }
+
+        TEST_METHOD(Test_Observer_Lifetime)
+        {
+            Nano::Dispatcher<Nano::TS_Policy_Safe<>> dispatcher;
+
+            {
+                Window<Observer_TSS> window;
+
+                dispatcher.connect<&Window<Observer_TSS>::on_resized>(window);
+                dispatcher.publish(Resized { 2, 2 });
+
+                Assert::IsTrue(window.area == 4, L"An event was not routed to its slot.");
+            }
+            dispatcher.publish(Resized { 2, 2 });
+
+            Assert::IsTrue(dispatcher.signal<Resized>().is_empty(), L"An observer was not disconnected.");
+        }
+    };
+}
@@ -0,0 +1,134 @@
+#include <future>
+#include <list>
+#include <vector>
+
+#include "CppUnitTest.h"
+
+#include "Test_Base.hpp"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace Nano_Tests
+{
+    TEST_CLASS(Test_Indexed_Policy)
+    {
+        const int N = 64;
+
+        template <typename Policy>
+        void test_connect_disconnect()
+        {
+            using Moo_T = Moo<Nano::Observer<Policy>>;
+            using Subject = Nano::Signal<void(Rng&), Policy>;
+
+            Subject subject;
+
+            for (int cycle = 0; cycle < 4; ++cycle)
+            {
+                std::list<Moo_T> moo(N);
+
+                for (auto& moo_instance : moo)
+                {
+                    subject.template connect<&Moo_T::slot_next_random>(moo_instance);
+                }
+
+                Rng rng;
+                Rng reference;
+
+                subject.fire(rng);
+                reference.discard(N);
+
+                Assert::IsTrue(rng == reference, L"An indexed slot was not invoked.");
+
+                bool odd = false;
+                for (auto& moo_instance : moo)
+                {
+                    if ((odd = !odd))
+                    {
+                        subject.template disconnect<&Moo_T::slot_next_random>(moo_instance);
+                    }
+                }
+
+                subject.fire(rng);
+                reference.discard(N / 2);
+
+                Assert::IsTrue(rng == reference, L"An indexed slot was not disconnected.");
+            }
+            Assert::IsTrue(subject.is_empty(), L"A signal was found not empty.");
+        }
+
+        public:
+
+        TEST_METHOD(Test_Indexed_Connect_Disconnect)
+        {
+            test_connect_disconnect<Nano::Indexed<Nano::ST_Policy>>();
+            test_connect_disconnect<Nano::Indexed<Nano::ST_Policy_Safe>>();
+            test_connect_disconnect<Nano::Indexed<Nano::TS_Policy<>>>();
+            test_connect_disconnect<Nano::Indexed<Nano::TS_Policy_Safe<>>>();
+        }
+
+        TEST_METHOD(Test_Indexed_Observer_Move)
+        {
+            using Policy = Nano::Indexed<Nano::ST_Policy>;
+            using Moo_T = Moo<Nano::Observer<Policy>>;
+
+            Nano::Signal<void(Rng&), Policy> subject;
+
+            std::vector<Moo_T> moo(N);
+
+            for (auto& moo_instance : moo)
+            {
+                subject.connect<&Moo_T::slot_next_random>(moo_instance);
+            }
+
+            // Reallocation moves every observer which must relink through the index, then destroys the sources
+            moo.reserve(moo.capacity() * 2);
+
+            // The slots remain bound to the destroyed sources, so the signal is disconnected rather than fired
+            moo.resize(N / 2);
+            Assert::IsFalse(subject.is_empty(), L"A moved observer disposed connections of another.");
+
+            // Reaches the remaining observers only if they were relinked
+            subject.disconnect_all();
+
+            for (auto& moo_instance : moo)
+            {
+                Assert::IsTrue(moo_instance.is_empty(), L"A moved observer was not relinked.");
+            }
+            Assert::IsTrue(subject.is_empty(), L"A moved observer failed to dispose connections.");
+        }
+
+        TEST_METHOD(Test_Indexed_Shared_Signal)
+        {
+            using Policy = Nano::Indexed<Nano::TS_Policy_Safe<>>;
+            using Moo_T = Moo<Nano::Observer<Policy>>;
+
+            Nano::Signal<void(Rng&), Policy> subject;
+
+            auto context = [&]()
+            {
+                Rng rng;
+
+                for (int count = 0; count < N; ++count)
+                {
+                    std::list<Moo_T> moo(N);
+
+                    for (auto& moo_instance : moo)
+                    {
+                        subject.connect<&Moo_T::slot_next_random>(moo_instance);
+                    }
+                    subject.fire(rng);
+                }
+            };
+            std::vector<std::future<void>> future_results;
+            for (std::size_t i = std::thread::hardware_concurrency(); i > 0; --i)
+            {
+                future_results.emplace_back(std::async(std::launch::async, context));
+            }
+            for (auto& future_result : future_results)
+            {
+                future_result.get();
+            }
+            Assert::IsTrue(subject.is_empty(), L"A signal was found not empty.");
+        }
+    };
+}
@@ -0,0 +1,238 @@
+#include <array>
+#include <list>
+#include <sstream>
+#include <string>
+
+#include "CppUnitTest.h"
+
+#include "Test_Base.hpp"
+#include "../nano_instrument.hpp"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace Nano_Tests
+{
+    TEST_CLASS(Test_Instrumented_Policy)
+    {
+        const int N = 64;
+
+        template <typename Policy>
+        void test_statistics()
+        {
+            using Moo_T = Moo<Nano::Observer<Policy>>;
+            using Subject = Nano::Signal<void(Rng&), Policy>;
+
+            Subject subject;
+
+            Rng rng;
+
+            {
+                std::list<Moo_T> moo(N);
+
+                for (auto& moo_instance : moo)
+                {
+                    subject.template connect<&Moo_T::slot_next_random>(moo_instance);
+                }
+                subject.fire(rng);
+                subject.fire(rng);
+
+                Assert::IsTrue(subject.statistics().connections == std::uint64_t(N), L"Connections were miscounted.");
+            }
+
+            auto statistics = subject.statistics();
+
+            Assert::IsTrue(statistics.fire_count == 2, L"Emissions were miscounted.");
+            Assert::IsTrue(statistics.slot_count == 2 * std::uint64_t(N), L"Slot invocations were miscounted.");
+            Assert::IsTrue(statistics.max_fan_out == std::uint64_t(N), L"Fan-out was misreported.");
+            Assert::IsTrue(statistics.connections == 0, L"Disconnections were miscounted.");
+        }
+
+        public:
+
+        TEST_METHOD(Test_ST_Statistics)
+        {
+            test_statistics<Nano::Instrumented<Nano::ST_Policy>>();
+            test_statistics<Nano::Instrumented<Nano::ST_Policy_Safe>>();
+        }
+
+        TEST_METHOD(Test_TS_Statistics)
+        {
+            test_statistics<Nano::Instrumented<Nano::TS_Policy<>>>();
+            test_statistics<Nano::Instrumented<Nano::TS_Policy_Safe<>>>();
+        }
+
+        TEST_METHOD(Test_Slot_Profile)
+        {
+            using Policy = Nano::Instrumented<Nano::TS_Policy<>>;
+            using Moo_T = Moo<Nano::Observer<Policy>>;
+
+            Nano::Signal<void(Rng&), Policy> subject;
+
+            Moo_T foo;
+            Moo_T bar;
+
+            subject.connect<&Moo_T::slot_next_random>(foo);
+            subject.connect<&Moo_T::slot_next_random>(bar);
+
+            Rng rng;
+
+            subject.fire(rng);
+            Assert::IsTrue(subject.histograms().empty(), L"A slot was profiled while disabled.");
+
+            subject.profile(true);
+
+            for (int i = 0; i < N; ++i)
+            {
+                subject.fire(rng);
+            }
+
+            auto histograms = subject.histograms();
+
+            Assert::IsTrue(histograms.size() == 2, L"A slot was found missing from the profile.");
+
+            for (auto const& [key, histogram] : histograms)
+            {
+                Assert::IsTrue(histogram.count() == std::uint64_t(N), L"A slot invocation was not profiled.");
+                Assert::IsTrue(histogram.percentile(50) <= histogram.max(), L"A percentile exceeded the max.");
+            }
+        }
+
+        TEST_METHOD(Test_Histogram_Percentile)
+        {
+            Nano::Histogram histogram;
+
+            for (int i = 1; i <= 1000; ++i)
+            {
+                histogram.record(std::chrono::nanoseconds(i));
+            }
+
+            auto p50 = histogram.percentile(50).count();
+
+            Assert::IsTrue(histogram.count() == 1000, L"A value was not recorded.");
+            Assert::IsTrue(p50 >= 500 && p50 < 516, L"The median exceeded the histogram precision.");
+            Assert::IsTrue(histogram.percentile(100).count() == 1000, L"The max was misreported.");
+        }
+
+        TEST_METHOD(Test_Trace_Export)
+        {
+            using Policy = Nano::Instrumented<Nano::ST_Policy>;
+            using Moo_T = Moo<Nano::Observer<Policy>>;
+
+            Nano::Signal<void(Rng&), Policy> subject("Test_Trace_Export");
+
+            Moo_T foo;
+
+            subject.connect<&Moo_T::slot_next_random>(foo);
+
+            Rng rng;
+
+            std::ostringstream discard;
+            Nano::Trace::write(discard);
+
+            Nano::Trace::enable(true);
+            subject.fire(rng);
+            Nano::Trace::enable(false);
+
+            std::ostringstream trace;
+            Nano::Trace::write(trace);
+
+            auto json = trace.str();
+            auto count = [&](const char* token)
+            {
+                std::size_t found = 0;
+                for (auto i = json.find(token); i != std::string::npos; i = json.find(token, i + 1))
+                {
+                    ++found;
+                }
+                return found;
+            };
+
+            Assert::IsTrue(json.find("Test_Trace_Export") != std::string::npos, L"The signal name was not exported.");
+            Assert::IsTrue(count("\"ph\":\"B\"") == 2, L"A begin event was not exported.");
+            Assert::IsTrue(count("\"ph\":\"B\"") == count("\"ph\":\"E\""), L"The begin and end events were unbalanced.");
+        }
+
+        TEST_METHOD(Test_Footprint_Shrink)
+        {
+            using Policy = Nano::Instrumented<Nano::TS_Policy<>>;
+            using Moo_T = Moo<Nano::Observer<Policy>>;
+
+            Nano::Signal<void(Rng&), Policy> subject("Test_Footprint_Shrink");
+
+            auto find = [&]()
+            {
+                for (auto const& entry : Nano::Footprint::snapshot())
+                {
+                    if (entry.name && std::string(entry.name) == "Test_Footprint_Shrink")
+                    {
+                        return entry;
+                    }
+                }
+                return Nano::Footprint::Entry();
+            };
+
+            subject.reserve(N);
+
+            Assert::IsTrue(find().capacity >= std::uint64_t(N), L"The reserved capacity was not reported.");
+            Assert::IsTrue(find().bytes > 0, L"The owned bytes were not reported.");
+
+            {
+                std::list<Moo_T> moo(N);
+
+                for (auto& moo_instance : moo)
+                {
+                    subject.connect<&Moo_T::slot_next_random>(moo_instance);
+                }
+                Assert::IsTrue(find().connections == std::uint64_t(N), L"A connection was not reported.");
+            }
+
+            subject.shrink_to_fit();
+
+            auto entry = find();
+
+            Assert::IsTrue(entry.name != nullptr, L"The signal was not registered.");
+            Assert::IsTrue(entry.connections == 0 && entry.capacity == 0, L"The dead capacity was not released.");
+        }
+
+        TEST_METHOD(Test_Footprint_Owned)
+        {
+            using Policy = Nano::Instrumented<Nano::ST_Policy>;
+
+            struct Large_Functor
+            {
+                std::array<char, 256> payload {};
+
+                void operator()(Rng& rng) const
+                {
+                    rng.discard(1);
+                }
+            };
+
+            Nano::Signal<void(Rng&), Policy> subject("Test_Footprint_Owned");
+
+            subject.connect<&slot_next_random_free_function>();
+            auto connected = subject.statistics().bytes;
+
+            auto key = subject.connect(Large_Functor());
+            auto owning = subject.statistics().bytes;
+
+            Assert::IsTrue(owning >= connected + sizeof(Large_Functor), L"The owned function objects were not reported.");
+
+            subject.mute_handle(key);
+            auto muting = subject.statistics().bytes;
+
+            Assert::IsTrue(muting > owning, L"The mute cells were not reported.");
+
+            Rng rng;
+            subject.fire(rng);
+
+            auto moved = std::move(subject);
+            auto statistics = moved.statistics();
+
+            Assert::IsTrue(std::string(moved.name()) == "Test_Footprint_Owned", L"A moved signal lost its name.");
+            Assert::IsTrue(statistics.fire_count == 1 && statistics.slot_count == 2, L"A moved signal lost its counters.");
+            Assert::IsTrue(statistics.bytes == muting, L"A moved signal misreported its footprint.");
+            Assert::IsTrue(subject.statistics().bytes < muting, L"A moved-from signal kept reporting the footprint.");
+        }
+    };
+}
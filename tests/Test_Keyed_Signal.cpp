@@ -0,0 +1,107 @@
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "CppUnitTest.h"
+
+#include "Test_Base.hpp"
+#include "../nano_keyed_signal.hpp"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace Nano_Tests
+{
+    namespace
+    {
+        template <typename Observer_T>
+        struct Quote_Book : Observer_T
+        {
+            std::size_t quotes = 0;
+
+            void on_quote(double)
+            {
+                ++quotes;
+            }
+        };
+    }
+
+    TEST_CLASS(Test_Keyed_Signal)
+    {
+        public:
+
+        TEST_METHOD(Test_Keyed_Fire)
+        {
+            Nano::Keyed_Signal<std::string, void(double)> signal;
+
+            std::vector<Quote_Book<Observer>> books(3);
+
+            signal.connect<&Quote_Book<Observer>::on_quote>("AAPL", books[0]);
+            signal.connect<&Quote_Book<Observer>::on_quote>("MSFT", books[1]);
+            signal.connect<&Quote_Book<Observer>::on_quote>("AAPL", "MSFT", books[2]);
+
+            signal.fire("AAPL", 1.0);
+            signal.fire("GOOG", 1.0);
+            signal.fire("NVDA", 1.0);
+
+            Assert::IsTrue(books[0].quotes == 1, L"A keyed slot was not invoked once.");
+            Assert::IsTrue(books[1].quotes == 0, L"A slot of another key was invoked.");
+            Assert::IsTrue(books[2].quotes == 2, L"A key range was not matched inclusively.");
+
+            signal.disconnect<&Quote_Book<Observer>::on_quote>("AAPL", books[0]);
+            signal.fire("AAPL", 1.0);
+
+            Assert::IsTrue(books[0].quotes == 1, L"A disconnected keyed slot was invoked.");
+
+            signal.disconnect<&Quote_Book<Observer>::on_quote>("A", "Z", books[2]);
+            signal.disconnect<&Quote_Book<Observer>::on_quote>("AAPL", "MSFT", books[2]);
+            signal.fire("AAPL", 1.0);
+
+            Assert::IsTrue(books[2].quotes == 3, L"A disconnected key range slot was invoked.");
+        }
+
+        TEST_METHOD(Test_Keyed_Range_Overlap)
+        {
+            Nano::Keyed_Signal<int, void(double)> signal;
+
+            const std::vector<std::pair<int, int>> ranges =
+            {
+                { 10, 20 }, { 0, 100 }, { 30, 40 }, { 5, 6 }, { 35, 36 }, { 50, 60 }, { 0, 3 }, { 38, 70 }
+            };
+            std::vector<Quote_Book<Observer>> books(ranges.size());
+
+            for (std::size_t i = 0; i < ranges.size(); ++i)
+            {
+                signal.connect<&Quote_Book<Observer>::on_quote>(ranges[i].first, ranges[i].second, books[i]);
+            }
+            for (int key = -1; key <= 101; ++key)
+            {
+                signal.fire(key, 1.0);
+            }
+            for (std::size_t i = 0; i < ranges.size(); ++i)
+            {
+                auto expected = static_cast<std::size_t>(ranges[i].second - ranges[i].first + 1);
+
+                Assert::IsTrue(books[i].quotes == expected, L"A key range was not matched exactly.");
+            }
+        }
+
+        TEST_METHOD(Test_Keyed_Observer_Lifetime)
+        {
+            Nano::Keyed_Signal<int, void(double), Nano::TS_Policy_Safe<>> signal;
+
+            {
+                Quote_Book<Observer_TSS> book;
+
+                signal.connect<&Quote_Book<Observer_TSS>::on_quote>(42, book);
+                signal.connect<&Quote_Book<Observer_TSS>::on_quote>(40, 49, book);
+                signal.fire(42, 1.0);
+
+                Assert::IsTrue(book.quotes == 2, L"A keyed slot was not invoked.");
+            }
+            signal.fire(42, 1.0);
+
+            Assert::IsTrue(signal.route(42).is_empty(), L"An observer was not disconnected.");
+            Assert::IsTrue(signal.route(40, 49).is_empty(), L"An observer was not disconnected.");
+        }
+    };
+}
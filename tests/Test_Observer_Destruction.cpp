@@ -1,5 +1,6 @@
 
 #include <iostream>
+#include <list>
 #include <memory>
 
 #include "CppUnitTest.h"
@@ -68,6 +69,54 @@ namespace Nano_Tests
             Assert::IsTrue(mo_signal_one.is_empty(), L"A slot was found.");
             Assert::IsTrue(mo_signal_two.is_empty(), L"A slot was found.");
         }
+
+        TEST_METHOD(Test_Interleaved_Observer_Destructor)
+        {
+            using Moo_T = Moo<Observer>;
+
+            Nano::Signal<void(Rng&)> signal;
+
+            std::list<Moo_T> moo(64);
+
+            for (auto& moo_instance : moo)
+            {
+                signal.connect<&Moo_T::slot_next_random>(moo_instance);
+            }
+            // Destroy every other observer so the signal holds live and dead slots
+            for (auto it = moo.begin(); it != moo.end(); )
+            {
+                it = std::next(moo.erase(it));
+            }
+
+            Rng rng_1;
+            Rng rng_2;
+            rng_2.discard(moo.size());
+
+            signal.fire(rng_1);
+            Assert::IsTrue(rng_1 == rng_2, L"A destroyed observer was emitted to.");
+
+            moo.clear();
+            Assert::IsTrue(signal.is_empty(), L"A slot was found.");
+        }
+
+        TEST_METHOD(Test_Shared_Slot_Signal_Destructor)
+        {
+            Signal_One signal;
+            {
+                Foo to_foo;
+
+                // The same slot connected to both signals shares a key at the observer
+                {
+                    Signal_One destroyed;
+
+                    destroyed.connect<Foo, &Foo::slot_virtual_member_function>(to_foo);
+                    signal.connect<Foo, &Foo::slot_virtual_member_function>(to_foo);
+                }
+                Assert::IsTrue(!signal.is_empty(), L"A slot of another signal was disconnected.");
+            }
+
+            Assert::IsTrue(signal.is_empty(), L"A slot was found.");
+        }
     };
 }
 
@@ -0,0 +1,146 @@
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "CppUnitTest.h"
+
+#include "Test_Base.hpp"
+#include "../nano_property.hpp"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace Nano_Tests
+{
+    namespace
+    {
+        template <typename Observer_T>
+        struct Label : Observer_T
+        {
+            std::vector<std::string> texts;
+
+            void on_text(std::string const& text)
+            {
+                texts.push_back(text);
+            }
+        };
+    }
+
+    TEST_CLASS(Test_Property)
+    {
+        public:
+
+        TEST_METHOD(Test_Commit_Suppression)
+        {
+            Nano::Property<std::string> property("one");
+
+            Label<Observer> label;
+            property.connect<&Label<Observer>::on_text>(label);
+
+            Assert::IsFalse(property.set("one"), L"An unchanged write was not suppressed.");
+            Assert::IsFalse(property.commit(), L"A clean property was notified.");
+
+            Assert::IsTrue(property.set("two"), L"A changed write was suppressed.");
+            property.set("three");
+
+            Assert::IsTrue(label.texts.empty(), L"A write was notified before commit.");
+            Assert::IsTrue(property.commit(), L"A dirty property was not notified.");
+            Assert::IsFalse(property.commit(), L"A committed property is still dirty.");
+
+            Assert::IsTrue(label.texts == std::vector<std::string> { "three" }, L"The final value was not notified once.");
+        }
+
+        TEST_METHOD(Test_Commit_Revert)
+        {
+            Nano::Property<std::string> property("one");
+
+            Label<Observer> label;
+            property.connect<&Label<Observer>::on_text>(label);
+
+            property.set("two");
+            Assert::IsTrue(property.set("one"), L"A changed write was suppressed.");
+
+            Assert::IsFalse(property.is_dirty(), L"A property reverted to its committed value is still dirty.");
+            Assert::IsFalse(property.commit(), L"A reverted property was notified.");
+
+            property.set("two");
+            property.commit();
+            property.set("one");
+            property.set("two");
+
+            Assert::IsFalse(property.commit(), L"A property reverted to its last commit was notified.");
+            Assert::IsTrue(label.texts == std::vector<std::string> { "two" }, L"A committed change was not notified once.");
+        }
+
+        TEST_METHOD(Test_Batch_Commit)
+        {
+            Nano::Property_Batch<Nano::TS_Policy_Safe<>> batch;
+            Nano::Property<std::string, Nano::TS_Policy_Safe<>> title("", batch);
+
+            Label<Observer_TSS> label;
+            title.connect<&Label<Observer_TSS>::on_text>(label);
+            {
+                Nano::Property<std::string, Nano::TS_Policy_Safe<>> status("", batch);
+
+                for (int i = 0; i < 100; ++i)
+                {
+                    title.set(std::to_string(i));
+                    status.set(std::to_string(i));
+                }
+            }
+            // The destroyed status left the batch
+            batch.commit();
+
+            Assert::IsTrue(batch.is_empty(), L"A batch was not emptied by commit.");
+            Assert::IsTrue(label.texts == std::vector<std::string> { "99" }, L"A batched property was not notified once.");
+
+            title.set("done");
+            title.commit();
+            batch.commit();
+
+            Assert::IsTrue(label.texts.size() == 2, L"A property committed directly was notified again.");
+        }
+
+        TEST_METHOD(Test_Batch_Destroyed_While_Committing)
+        {
+            using Policy = Nano::TS_Policy_Safe<>;
+
+            struct Slow_Label : Observer_TSS
+            {
+                std::atomic_bool entered = { false };
+                std::atomic_bool finished = { false };
+
+                void on_text(std::string const&)
+                {
+                    entered = true;
+                    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+                    finished = true;
+                }
+            };
+
+            Nano::Property_Batch<Policy> batch;
+            auto title = std::make_unique<Nano::Property<std::string, Policy>>("", batch);
+
+            Slow_Label label;
+            title->connect<&Slow_Label::on_text>(label);
+            title->set("one");
+
+            std::thread committer([&batch] { batch.commit(); });
+
+            while (!label.entered)
+            {
+                std::this_thread::yield();
+            }
+            // Waits for the commit running on the other thread
+            title.reset();
+            bool finished = label.finished;
+
+            committer.join();
+
+            Assert::IsTrue(finished, L"A property was destroyed while being committed.");
+            Assert::IsTrue(batch.is_empty(), L"A batch was not emptied by commit.");
+        }
+    };
+}
@@ -1,4 +1,5 @@
 #include <list>
+#include <memory>
 
 #include "CppUnitTest.h"
 
@@ -80,5 +81,53 @@ namespace Nano_Tests
             Assert::IsTrue(foo1.is_empty(), L"Signal failed to dispose connections.");
             Assert::IsTrue(foo2.is_empty(), L"Signal failed to dispose connections.");
         }
+
+        TEST_METHOD(Test_Observer_Move)
+        {
+            Subject sig1;
+            Subject sig2;
+
+            auto rng1 = Rng();
+            auto rng2 = Rng();
+
+            {
+                Moo_T foo1;
+
+                sig1.connect<&Moo_T::slot_next_random>(foo1);
+                sig2.connect<&Moo_T::slot_next_random>(foo1);
+                {
+                    Moo_T foo2(std::move(foo1));
+                    Assert::IsTrue(foo1.is_empty(), L"Observer failed to remove connections during move.");
+                    Assert::IsFalse(foo2.is_empty(), L"Observer failed to move connections to target.");
+
+                    // The slots remain bound to foo1 which is still alive
+                    sig1.fire(rng1);
+                    sig2.fire(rng1);
+                    rng2.discard(2);
+                    Assert::IsTrue(rng1 == rng2, L"Observer failed to keep all connections.");
+                }
+                Assert::IsTrue(sig1.is_empty(), L"Moved-to observer failed to dispose connections.");
+                Assert::IsTrue(sig2.is_empty(), L"Moved-to observer failed to dispose connections.");
+            }
+            // Nothing may refer to the destroyed moved-from observer
+            sig1.fire(rng1);
+            sig2.fire(rng1);
+            Assert::IsTrue(rng1 == rng2, L"A destroyed observer is still connected.");
+
+            {
+                auto foo1 = std::make_unique<Moo_T>();
+
+                sig1.connect<&Moo_T::slot_next_random>(*foo1);
+                sig2.connect<&Moo_T::slot_next_random>(*foo1);
+
+                Moo_T foo2(std::move(*foo1));
+                foo1.reset();
+
+                // Disconnecting from the signals reaches foo2 only if their connections were relinked
+                sig1.disconnect_all();
+                sig2.disconnect_all();
+                Assert::IsTrue(foo2.is_empty(), L"Observer failed to relink all connections.");
+            }
+        }
     };
 }
@@ -1,3 +1,4 @@
+#include <array>
 #include <list>
 
 #include "CppUnitTest.h"
@@ -200,5 +201,26 @@ namespace Nano_Tests
 
             signal.fire(Rng());
         }
+
+        TEST_METHOD(Test_Fire_Owned_Disconnect)
+        {
+            Subject signal;
+
+            std::size_t count = 0;
+            Nano::Delegate_Key key;
+
+            // The owned function object must survive disconnecting itself mid emission
+            key = signal.connect([&signal, &key, &count, padding = std::array<char, 64>()](Rng&)
+            {
+                signal.disconnect(key);
+                count += padding.size();
+            });
+
+            signal.fire(Rng());
+            signal.fire(Rng());
+
+            Assert::IsTrue(count == 64, L"An owned function object was invoked after disconnecting.");
+            Assert::IsTrue(signal.is_empty(), L"A slot was not disconnected.");
+        }
     };
 }
@@ -1,5 +1,6 @@
 
 #include <iostream>
+#include <string>
 
 #include "CppUnitTest.h"
 
@@ -96,5 +97,22 @@ namespace Nano_Tests
             mo_signal_two.connect<&slot_static_free_function>();
             Assert::IsFalse(mo_signal_two.is_empty(), L"A slot was found missing.");
         }
+
+        TEST_METHOD(Test_Owned_Function_Object_Connect)
+        {
+            std::size_t count = 0;
+            std::string large(64, '!');
+
+            auto key_one = mo_signal_one.connect([&count](const char*) { ++count; });
+            auto key_two = mo_signal_one.connect([&count, large](const char* sl) { count += large.size() + (sl != nullptr); });
+            Assert::IsFalse(mo_signal_one.is_empty(), L"A slot was found missing.");
+
+            mo_signal_one.fire(__FUNCTION__);
+            Assert::IsTrue(count == 66, L"An owned function object was not invoked.");
+
+            mo_signal_one.disconnect(key_one);
+            mo_signal_one.disconnect(key_two);
+            Assert::IsTrue(mo_signal_one.is_empty(), L"An owned function object was not disconnected.");
+        }
     };
 }
@@ -1,5 +1,6 @@
 
 #include <iostream>
+#include <vector>
 
 #include "CppUnitTest.h"
 
@@ -192,5 +193,73 @@ namespace Nano_Tests
             Assert::IsTrue(mo_foo.is_empty(), L"A slot was found.");
             Assert::IsTrue(mo_bar.is_empty(), L"A slot was found.");
         }
+
+        TEST_METHOD(Test_Disconnect_After_Burst)
+        {
+            std::vector<Foo> foos(16);
+
+            // The first burst is merged by the emission, the second is left appended
+            for (std::size_t i = 0; i < foos.size(); ++i)
+            {
+                if (i == foos.size() / 2)
+                {
+                    mo_signal_one.fire(__FUNCTION__);
+                }
+                mo_signal_one.connect<&Foo::slot_member_signature_one>(foos[foos.size() - i - 1]);
+                mo_signal_one.connect<&Foo::slot_const_member_signature_one>(foos[i]);
+            }
+
+            for (auto& foo : foos)
+            {
+                mo_signal_one.disconnect<&Foo::slot_member_signature_one>(foo);
+                mo_signal_one.disconnect<&Foo::slot_const_member_signature_one>(foo);
+                Assert::IsTrue(foo.is_empty(), L"A slot was found.");
+            }
+            Assert::IsTrue(mo_signal_one.is_empty(), L"A slot was found.");
+        }
+
+        TEST_METHOD(Test_Group_Disconnect)
+        {
+            std::vector<Foo> foos(16);
+
+            Nano::Group odd;
+            {
+                Nano::Group even;
+
+                for (std::size_t i = 0; i < foos.size(); ++i)
+                {
+                    Nano::Group_Scope scope(i % 2 ? odd : even);
+
+                    mo_signal_one.connect<&Foo::slot_member_signature_one>(foos[i]);
+                    mo_signal_two.connect<&Foo::slot_member_signature_two>(foos[i]);
+                }
+                {
+                    Nano::Group_Scope scope(odd);
+
+                    mo_signal_one.connect([](const char*) {});
+                }
+
+                // Every signal connected to within the group is disconnected without naming them
+                odd.disconnect();
+
+                for (std::size_t i = 0; i < foos.size(); ++i)
+                {
+                    Assert::IsTrue(foos[i].is_empty() == (i % 2 == 1), L"A slot was disconnected from the wrong group.");
+                }
+                Assert::IsFalse(mo_signal_one.is_empty(), L"A slot was disconnected from the wrong group.");
+            }
+            // Destroying a group disconnects it
+            Assert::IsTrue(mo_signal_one.is_empty(), L"A slot was found.");
+            Assert::IsTrue(mo_signal_two.is_empty(), L"A slot was found.");
+
+            {
+                Nano::Signal<void(const char*)> signal_three;
+
+                Nano::Group_Scope scope(odd);
+                signal_three.connect<&Foo::slot_member_signature_one>(foos[0]);
+            }
+            // A destroyed signal was forgotten by its group
+            odd.disconnect();
+        }
     };
 }
@@ -1,5 +1,9 @@
 
+#include <algorithm>
+#include <cstdint>
 #include <iostream>
+#include <set>
+#include <string>
 #include <vector>
 
 #include "CppUnitTest.h"
@@ -104,6 +108,114 @@ namespace Nano_Tests
             Assert::IsTrue(signal_return_values.size() == 10, L"An SRV was found missing.");
         }
 
+        TEST_METHOD(Test_Fire_Accumulate_Stop)
+        {
+            Nano::Signal<std::size_t(std::size_t)> signal_three;
+
+            std::size_t calls = 0;
+            auto slot_one = [&](std::size_t val) { ++calls; return val; };
+            auto slot_two = [&](std::size_t val) { ++calls; return val; };
+            auto slot_three = [&](std::size_t val) { ++calls; return val; };
+
+            signal_three.connect(slot_one);
+            signal_three.connect(slot_two);
+            signal_three.connect(slot_three);
+
+            std::size_t sum = 0;
+            auto accumulator = [&](std::size_t srv)
+            {
+                sum += srv;
+                return sum < 2 ? Nano::Flow::Continue : Nano::Flow::Stop;
+            };
+
+            auto stopped = signal_three.fire_accumulate(accumulator, 1);
+
+            Assert::IsTrue(calls == 2, L"The emission was not stopped by the accumulator.");
+            Assert::IsTrue(stopped.has_value(), L"The stopping slot was not reported.");
+
+            // Accumulators returning bool keep their meaning and never stop the emission
+            calls = 0;
+            std::set<std::size_t> seen;
+            stopped = signal_three.fire_accumulate([&](std::size_t srv) { return seen.insert(srv).second; }, 1);
+
+            Assert::IsTrue(calls == 3, L"The emission was stopped by an accumulator returning bool.");
+            Assert::IsFalse(stopped.has_value(), L"A stopping slot was reported.");
+        }
+
+        TEST_METHOD(Test_Fire_Until)
+        {
+            Nano::Signal<bool(std::size_t)> signal_three;
+
+            std::size_t calls = 0;
+            auto slot_one = [&](std::size_t) { ++calls; return true; };
+            auto slot_two = [&](std::size_t) { ++calls; return true; };
+
+            signal_three.connect(slot_one);
+            signal_three.connect(slot_two);
+
+            auto consumed = [](bool srv) { return srv; };
+
+            auto stopped = signal_three.fire_until(consumed, __LINE__);
+
+            Assert::IsTrue(calls == 1, L"The emission was not stopped by the predicate.");
+            Assert::IsTrue(stopped == Nano::Delegate_Key(Nano::Function<bool(std::size_t)>::bind(&slot_one))
+                || stopped == Nano::Delegate_Key(Nano::Function<bool(std::size_t)>::bind(&slot_two)),
+                L"The stopping slot was misreported.");
+
+            calls = 0;
+            stopped = signal_three.fire_while(consumed, __LINE__);
+
+            Assert::IsTrue(calls == 2, L"The emission was stopped early.");
+            Assert::IsFalse(stopped.has_value(), L"A stopping slot was reported.");
+        }
+
+        TEST_METHOD(Test_Fire_Combine)
+        {
+            Nano::Signal<int(int)> signal_three;
+
+            auto slot_one = [](int val) { return val; };
+            auto slot_two = [](int val) { return val * 2; };
+            auto slot_three = [](int val) { return val * 3; };
+
+            signal_three.connect(slot_one);
+            signal_three.connect(slot_two);
+            signal_three.connect(slot_three);
+
+            Assert::IsTrue(signal_three.fire_accumulate<Nano::Combine::Sum>(2) == 12, L"Sum combined incorrectly.");
+            Assert::IsTrue(signal_three.fire_accumulate<Nano::Combine::Min>(2) == 2, L"Min combined incorrectly.");
+            Assert::IsTrue(signal_three.fire_accumulate<Nano::Combine::Max>(2) == 6, L"Max combined incorrectly.");
+            Assert::IsTrue(signal_three.fire_accumulate<Nano::Combine::Last>(2).has_value(), L"Last combined incorrectly.");
+
+            int buffer[2] = {};
+            Nano::Combine::Collect_Into<int> collect(std::begin(buffer), std::end(buffer));
+            signal_three.fire_accumulate(collect, 1);
+
+            Assert::IsTrue(collect.result() == 2, L"Collect_Into overran its storage.");
+        }
+
+        TEST_METHOD(Test_Fire_Combine_Short_Circuit)
+        {
+            Nano::Signal<bool(bool)> signal_three;
+
+            std::size_t calls = 0;
+            auto slot_one = [&](bool val) { ++calls; return val; };
+            auto slot_two = [&](bool val) { ++calls; return val; };
+
+            signal_three.connect(slot_one);
+            signal_three.connect(slot_two);
+
+            Assert::IsFalse(signal_three.fire_accumulate<Nano::Combine::All>(false), L"All combined incorrectly.");
+            Assert::IsTrue(calls == 1, L"All failed to short-circuit.");
+
+            calls = 0;
+            Assert::IsTrue(signal_three.fire_accumulate<Nano::Combine::Any>(true), L"Any combined incorrectly.");
+            Assert::IsTrue(calls == 1, L"Any failed to short-circuit.");
+
+            calls = 0;
+            Assert::IsTrue(signal_three.fire_accumulate<Nano::Combine::All>(true), L"All combined incorrectly.");
+            Assert::IsTrue(calls == 2, L"All stopped early.");
+        }
+
         //----------------------------------------------------------------------
 
         TEST_METHOD(Test_Fire_Single_Copy)
@@ -172,5 +284,308 @@ namespace Nano_Tests
 
             signal_one.fire(Copy_Count());
         }
+
+        TEST_METHOD(Test_Fire_LValue_Preserved)
+        {
+            Nano::Signal<void(std::string)> signal_one;
+
+            auto slot_one = [](std::string sl)
+            {
+                Assert::IsTrue(sl == "main screen turn on", L"An lvalue parameter was moved from.");
+            };
+
+            signal_one.connect(slot_one);
+
+            auto slot_two = [](std::string sl)
+            {
+                Assert::IsTrue(sl == "main screen turn on", L"An lvalue parameter was moved from.");
+            };
+
+            signal_one.connect(slot_two);
+
+            std::string sl = "main screen turn on";
+
+            signal_one.fire(sl);
+
+            Assert::IsTrue(sl == "main screen turn on", L"The caller's argument was moved from.");
+        }
+
+        TEST_METHOD(Test_Fire_RValue_Last_Move)
+        {
+            Nano::Signal<void(Move_Count)> signal_one;
+
+            std::size_t copies = 0;
+            std::size_t moves = 0;
+
+            auto slot_one = [&](Move_Count mc)
+            {
+                copies += mc.copies;
+                moves += mc.moves;
+            };
+
+            signal_one.connect(slot_one);
+
+            auto slot_two = [&](Move_Count mc)
+            {
+                copies += mc.copies;
+                moves += mc.moves;
+            };
+
+            signal_one.connect(slot_two);
+
+            signal_one.fire(Move_Count());
+
+            Assert::IsTrue(copies == 1, L"An rvalue parameter wasn't copied once.");
+            Assert::IsTrue(moves == 1, L"An rvalue parameter wasn't moved into the final slot.");
+
+            Move_Count mc;
+
+            copies = moves = 0;
+            signal_one.fire_move(mc);
+
+            Assert::IsTrue(copies == 1, L"A parameter wasn't copied once.");
+            Assert::IsTrue(moves == 1, L"A parameter wasn't moved into the final slot.");
+        }
+
+        TEST_METHOD(Test_Fire_Thunk_Grouped)
+        {
+            struct Tally : Observer
+            {
+                std::vector<int>* order = nullptr;
+
+                void slot_one(const char*) { order->push_back(1); }
+                void slot_two(const char*) { order->push_back(2); }
+            };
+
+            std::vector<int> order;
+            std::vector<Tally> tallies(32);
+
+            for (auto& tally : tallies)
+            {
+                tally.order = &order;
+                mo_signal_one.connect<&Tally::slot_one>(tally);
+                mo_signal_one.connect<&Tally::slot_two>(tally);
+            }
+
+            mo_signal_one.fire(__FUNCTION__);
+
+            std::size_t runs = 1;
+            for (std::size_t i = 1; i < order.size(); ++i)
+            {
+                runs += order[i] != order[i - 1];
+            }
+
+            Assert::IsTrue(order.size() == 64, L"A slot was not invoked.");
+            Assert::IsTrue(runs == 2, L"Slots sharing a thunk were not emitted consecutively.");
+        }
+
+        TEST_METHOD(Test_Fire_Thunk_Grouped_Bursts)
+        {
+            struct Tally : Observer
+            {
+                std::vector<int>* order = nullptr;
+
+                void slot_one(const char*) { order->push_back(1); }
+                void slot_two(const char*) { order->push_back(2); }
+                void slot_three(const char*) { order->push_back(3); }
+            };
+
+            std::vector<int> order;
+            std::vector<Tally> tallies(48);
+
+            // Every burst is emitted once before the next one is connected
+            for (std::size_t burst = 0; burst < tallies.size(); burst += 16)
+            {
+                for (std::size_t i = burst; i < burst + 16; ++i)
+                {
+                    tallies[i].order = &order;
+                    mo_signal_one.connect<&Tally::slot_three>(tallies[i]);
+                    mo_signal_one.connect<&Tally::slot_one>(tallies[i]);
+                    mo_signal_one.connect<&Tally::slot_two>(tallies[i]);
+                }
+                order.clear();
+                mo_signal_one.fire(__FUNCTION__);
+            }
+
+            std::size_t runs = 1;
+            for (std::size_t i = 1; i < order.size(); ++i)
+            {
+                runs += order[i] != order[i - 1];
+            }
+
+            Assert::IsTrue(order.size() == 144, L"A slot was not invoked.");
+            Assert::IsTrue(runs == 3, L"Connections appended after an emission were not merged into their runs.");
+        }
+
+        TEST_METHOD(Test_Fire_Member_Context)
+        {
+            struct Channels : Observer
+            {
+                std::vector<std::size_t> fired;
+
+                void slot_channel(std::uint16_t channel, const char*) { fired.push_back(channel); }
+            };
+
+            {
+                Channels channels;
+
+                for (std::uint16_t channel = 0; channel < 64; ++channel)
+                {
+                    mo_signal_one.connect<&Channels::slot_channel>(channels, channel);
+                }
+                mo_signal_one.disconnect<&Channels::slot_channel>(channels, std::uint16_t(7));
+
+                mo_signal_one.fire(__FUNCTION__);
+
+                std::sort(std::begin(channels.fired), std::end(channels.fired));
+
+                Assert::IsTrue(channels.fired.size() == 63, L"A context slot was not invoked once.");
+                Assert::IsTrue(channels.fired[7] == 8, L"The context was not part of the connection identity.");
+                Assert::IsTrue(channels.fired.back() == 63, L"A context was not passed to its slot.");
+            }
+            Assert::IsTrue(mo_signal_one.is_empty(), L"A context slot was not disconnected.");
+        }
+
+        TEST_METHOD(Test_Fire_Adapted_Slots)
+        {
+            struct Adapted : Observer
+            {
+                std::size_t calls = 0;
+
+                void slot_prefix(const char*) { ++calls; }
+                void slot_none() { ++calls; }
+                bool slot_converted(std::string sl, long line) { calls += !sl.empty() && line > 0; return true; }
+            };
+
+            Adapted adapted;
+
+            mo_signal_two.connect<&Adapted::slot_prefix>(adapted);
+            mo_signal_two.connect<&Adapted::slot_none>(adapted);
+            mo_signal_two.connect<&Adapted::slot_converted>(adapted);
+
+            mo_signal_two.fire(__FUNCTION__, __LINE__);
+            Assert::IsTrue(adapted.calls == 3, L"An adapted slot was not invoked.");
+
+            mo_signal_two.disconnect<&Adapted::slot_none>(adapted);
+            mo_signal_two.fire(__FUNCTION__, __LINE__);
+            Assert::IsTrue(adapted.calls == 5, L"An adapted slot was not disconnected.");
+        }
+
+        TEST_METHOD(Test_Fire_Forward)
+        {
+            Nano::Signal<void(Copy_Count)> signal_one;
+
+            std::size_t calls = 0;
+            auto slot_one = [&](Copy_Count cc)
+            {
+                Assert::IsTrue(cc.count == 1, L"A forwarded parameter was copied more than once.");
+                ++calls;
+            };
+
+            {
+                Nano::Signal<void(Copy_Count)> signal_two;
+                Nano::Signal<void(Copy_Count)> signal_three;
+
+                signal_two.connect(slot_one);
+                signal_three.connect(slot_one);
+
+                signal_one.forward_to(signal_two);
+                signal_two.forward_to(signal_three);
+
+                Copy_Count cc;
+                signal_one.fire(cc);
+                Assert::IsTrue(calls == 2, L"A forwarded slot was not invoked.");
+
+                signal_two.disconnect_forward(signal_three);
+                signal_one.fire(cc);
+                Assert::IsTrue(calls == 3, L"A forward was not disconnected.");
+            }
+            Assert::IsTrue(signal_one.is_empty(), L"A forward outlived its target.");
+        }
+
+        TEST_METHOD(Test_Fire_Blocked)
+        {
+            std::size_t calls = 0;
+            auto slot_one = [&](const char*) { ++calls; };
+
+            mo_signal_one.connect(slot_one);
+
+            {
+                auto blocker = mo_signal_one.blocker();
+                mo_signal_one.block();
+
+                mo_signal_one.fire(__FUNCTION__);
+                mo_signal_one.unblock();
+                mo_signal_one.fire(__FUNCTION__);
+
+                Assert::IsTrue(calls == 0, L"A blocked signal was emitted.");
+            }
+            mo_signal_one.fire(__FUNCTION__);
+            Assert::IsTrue(calls == 1, L"An unblocked signal was not emitted.");
+        }
+
+        TEST_METHOD(Test_Fire_Muted)
+        {
+            std::size_t calls_one = 0;
+            std::size_t calls_two = 0;
+            auto slot_one = [&](const char*) { ++calls_one; };
+            auto slot_two = [&](const char*) { ++calls_two; };
+
+            mo_signal_one.connect(slot_one);
+            mo_signal_one.connect(slot_two);
+
+            auto key = Nano::Function<void(const char*)>::bind(&slot_one);
+
+            mo_signal_one.mute(key);
+            mo_signal_one.fire(__FUNCTION__);
+
+            Assert::IsTrue(calls_one == 0, L"A muted slot was invoked.");
+            Assert::IsTrue(calls_two == 1, L"An unmuted slot was not invoked.");
+            Assert::IsFalse(mo_signal_one.is_empty(), L"A muted slot was disconnected.");
+
+            mo_signal_one.unmute(key);
+            mo_signal_one.fire(__FUNCTION__);
+
+            Assert::IsTrue(calls_one == 1, L"An unmuted slot was not invoked.");
+        }
+
+        TEST_METHOD(Test_Fire_Mute_Handle)
+        {
+            std::size_t calls_one = 0;
+            std::size_t calls_two = 0;
+            auto slot_one = [&](const char*) { ++calls_one; };
+            auto slot_two = [&](const char*) { ++calls_two; };
+
+            auto key = Nano::Function<void(const char*)>::bind(&slot_one);
+
+            Assert::IsFalse(bool(mo_signal_one.mute_handle(key)), L"A handle was obtained for a missing key.");
+
+            mo_signal_one.connect(slot_one);
+
+            auto handle = mo_signal_one.mute_handle(key);
+            handle.mute();
+
+            // Growing, merging and compacting the connections must not invalidate the handle
+            std::vector<decltype(slot_two)> slots(64, slot_two);
+
+            for (auto& slot : slots)
+            {
+                mo_signal_one.connect(slot);
+            }
+            for (std::size_t i = 0; i < slots.size(); i += 2)
+            {
+                mo_signal_one.disconnect(slots[i]);
+            }
+            mo_signal_one.shrink_to_fit();
+            mo_signal_one.fire(__FUNCTION__);
+
+            Assert::IsTrue(calls_one == 0 && handle.is_muted(), L"A muted slot was invoked.");
+            Assert::IsTrue(calls_two == 32, L"An unmuted slot was not invoked.");
+
+            handle.unmute();
+            mo_signal_one.fire(__FUNCTION__);
+
+            Assert::IsTrue(calls_one == 1, L"An unmuted slot was not invoked.");
+        }
     };
 }
@@ -0,0 +1,108 @@
+#include <string>
+#include <vector>
+
+#include "CppUnitTest.h"
+
+#include "Test_Base.hpp"
+#include "../nano_static_signal.hpp"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace Nano_Tests
+{
+    namespace
+    {
+        struct Gain
+        {
+            int factor = 1;
+
+            int scale(int value) const
+            {
+                return value * factor;
+            }
+        };
+
+        struct Transcript
+        {
+            std::vector<std::string> seen;
+            std::string taken;
+
+            void peek(std::string const& text)
+            {
+                seen.push_back(text);
+            }
+            void copy(std::string text)
+            {
+                seen.push_back(std::move(text));
+            }
+            void take(std::string&& text)
+            {
+                taken = std::move(text);
+            }
+        };
+
+        static int negate(int value)
+        {
+            return -value;
+        }
+    }
+
+    TEST_CLASS(Test_Static_Signal)
+    {
+        public:
+
+        TEST_METHOD(Test_Static_Fire)
+        {
+            using Moo_T = Moo<Observer_ST>;
+
+            Moo_T moo;
+
+            Nano::Static_Signal<void(Rng&), &Moo_T::slot_next_random,
+                &Moo_T::slot_static_next_random, &slot_next_random_free_function> subject(moo);
+
+            Rng rng;
+            Rng reference;
+
+            subject.fire(rng);
+            reference.discard(3);
+
+            Assert::IsTrue(rng == reference, L"A static slot was not invoked.");
+        }
+
+        TEST_METHOD(Test_Static_Accumulate)
+        {
+            Gain twice { 2 };
+            Gain thrice { 3 };
+
+            Nano::Static_Signal<int(int), &Gain::scale, &negate, &Gain::scale> subject(twice, thrice);
+
+            std::vector<int> srvs;
+            subject.fire_accumulate([&](int srv) { srvs.push_back(srv); }, 5);
+
+            Assert::IsTrue(srvs == std::vector<int>({ 10, -5, 15 }), L"The slots were bound or invoked out of order.");
+            Assert::IsTrue(subject.fire_accumulate<Nano::Combine::Sum>(1) == 4, L"Sum combined incorrectly.");
+
+            auto stopped = subject.fire_until([](int srv) { return srv < 0; }, 1);
+
+            Assert::IsTrue(stopped && *stopped == 1, L"The emission did not stop at the negative slot.");
+        }
+
+        TEST_METHOD(Test_Static_RValue_Last_Move)
+        {
+            Transcript transcript;
+
+            Nano::Static_Signal<void(std::string), &Transcript::peek, &Transcript::copy, &Transcript::take>
+                subject(transcript, transcript, transcript);
+
+            const std::string original("main screen turn on");
+            std::string text(original);
+
+            subject.fire(std::move(text));
+
+            Assert::IsTrue(transcript.seen == std::vector<std::string>({ original, original }),
+                L"An rvalue argument was consumed before the final slot.");
+            Assert::IsTrue(transcript.taken == original, L"The final slot did not receive the argument.");
+            Assert::IsTrue(text.empty(), L"An rvalue argument was not moved into the final slot.");
+        }
+    };
+}